@@ -0,0 +1,59 @@
+#include "allocationcounter.h"
+
+#ifdef BIOSIM_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<unsigned long long> allocations{0};
+
+bool AllocationCounter::enabled() { return true; }
+unsigned long long AllocationCounter::count() { return allocations.load(std::memory_order_relaxed); }
+
+// ============================================================================
+// REMPLACEMENT DE operator new / delete
+// ============================================================================
+// Les formes tableau et nothrow par défaut passent par ces versions.
+// ============================================================================
+static void* alignedMalloc(std::size_t size, std::size_t align) {
+#ifdef _MSC_VER
+    return _aligned_malloc(size, align);
+#else
+    // aligned_alloc exige une taille multiple de l'alignement
+    return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+}
+
+static void alignedFree(void* p) {
+#ifdef _MSC_VER
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = alignedMalloc(size ? size : 1, static_cast<std::size_t>(align)))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { alignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+
+#else
+
+bool AllocationCounter::enabled() { return false; }
+unsigned long long AllocationCounter::count() { return 0; }
+
+#endif
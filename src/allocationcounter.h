@@ -0,0 +1,20 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+// ============================================================================
+// ALLOCATION COUNTER - Compteur global des appels à operator new (debug)
+// ============================================================================
+// Compilé avec BIOSIM_COUNT_ALLOCATIONS (option CMake du même nom),
+// operator new/delete sont remplacés pour compter chaque allocation sur le
+// tas, tous threads confondus. Simulation::update affiche le nombre
+// d'allocations du dernier tick dans le debug monitor ("allocsPerTick"):
+// il doit rester à 0 en régime établi, hors naissances de l'évolution et
+// nourriture accumulée au-delà de la réserve de FoodIndex (pool doublé).
+// Sans l'option, enabled() est faux et count() vaut toujours 0.
+// ============================================================================
+namespace AllocationCounter {
+    bool enabled();
+    unsigned long long count();
+}
+
+#endif // ALLOCATIONCOUNTER_H
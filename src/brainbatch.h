@@ -0,0 +1,69 @@
+#ifndef BRAINBATCH_H
+#define BRAINBATCH_H
+#include "neuralnetwork.h"
+#include "scratcharena.h"
+#include <cstring>
+
+// ============================================================================
+// BRAIN BATCH - Inférence groupée de tous les cerveaux d'une espèce
+// ============================================================================
+// Au lieu d'appeler brain.forward() entité par entité, Simulation remplit
+// une matrice d'entrées (une ligne par entité), puis evaluate() passe la
+// couche cachée sur TOUTES les lignes, puis la couche de sortie sur toutes
+// les lignes. Chaque entité garde ses propres poids: c'est un produit
+// matrice-vecteur par ligne, mais enchaîné sans appel ni allocation par
+// entité. Le résultat est une matrice d'actions (angle, poussée).
+// Network est la topologie de l'espèce (Prey::Brain, Predator::Brain): les
+// lignes ont la même largeur paddée que les lignes de poids du réseau.
+// Les matrices sont prises dans la ScratchArena du tick: elles ne sont
+// valides que jusqu'au prochain reset() de l'arène.
+// ============================================================================
+template <typename Network>
+class BrainBatch {
+public:
+    static constexpr int InStride = Network::InStride;
+    static constexpr int HiddenStride = Network::HiddenStride;
+    static constexpr int OutStride = Network::OutStride;
+
+    // Prépare count lignes dans l'arène. Entrées et couche cachée sont mises
+    // à zéro: les noyaux lisent leur padding.
+    void resize(size_t count, ScratchArena& arena) {
+        rows = count;
+        networks = arena.allocate<const Network*>(count);
+        inputs = arena.allocate<float>(count * InStride);
+        hiddens = arena.allocate<float>(count * HiddenStride);
+        outputs = arena.allocate<float>(count * OutStride);
+        std::memset(inputs, 0, count * InStride * sizeof(float));
+        std::memset(hiddens, 0, count * HiddenStride * sizeof(float));
+    }
+    size_t size() const { return rows; }
+
+    float* input(size_t row) { return inputs + row * InStride; }
+    const float* output(size_t row) const { return outputs + row * OutStride; }
+    void setNetwork(size_t row, const Network* network) { networks[row] = network; }
+
+    // Une passe par couche sur toute la population
+    void evaluate() { evaluate(0, rows); }
+    // Idem sur les lignes [begin, end) seulement (un bloc du TaskScheduler)
+    void evaluate(size_t begin, size_t end);
+
+private:
+    size_t rows = 0;
+    const Network** networks = nullptr;
+    float* inputs = nullptr;
+    float* hiddens = nullptr;
+    float* outputs = nullptr;
+};
+
+template <typename Network>
+void BrainBatch<Network>::evaluate(size_t begin, size_t end) {
+    // ========== COUCHE 1: entrées -> couche cachée ==========
+    for (size_t r = begin; r < end; ++r)
+        networks[r]->hiddenLayer(inputs + r * InStride, hiddens + r * HiddenStride);
+
+    // ========== COUCHE 2: couche cachée -> sorties ==========
+    for (size_t r = begin; r < end; ++r)
+        networks[r]->outputLayer(hiddens + r * HiddenStride, outputs + r * OutStride);
+}
+
+#endif // BRAINBATCH_H
@@ -0,0 +1,79 @@
+#include "camera.h"
+#include <algorithm>
+
+Camera::Camera(sf::Vector2f worldSize, sf::Vector2f screenSize)
+    : worldSize(worldSize), screenSize(screenSize) {
+    reset();
+}
+
+void Camera::reset() {
+    current.setSize(screenSize / minScale());
+    current.setCenter(worldSize / 2.0f);
+}
+
+sf::FloatRect Camera::visibleArea() const {
+    return {current.getCenter() - current.getSize() / 2.0f, current.getSize()};
+}
+
+// Zoom minimal: le monde entier tient à l'écran
+float Camera::minScale() const {
+    return std::min(screenSize.x / worldSize.x, screenSize.y / worldSize.y);
+}
+
+// La vue occupe toute la fenêtre (viewport par défaut)
+sf::Vector2f Camera::screenToWorld(sf::Vector2i pixel) const {
+    return current.getCenter() + (sf::Vector2f(pixel) - screenSize / 2.0f) / scale();
+}
+
+// ============================================================================
+// ÉVÉNEMENTS
+// ============================================================================
+void Camera::handleEvent(const sf::Event& event) {
+    if (const auto* scrolled = event.getIf<sf::Event::MouseWheelScrolled>()) {
+        if (scrolled->wheel == sf::Mouse::Wheel::Vertical)
+            zoomAt(scrolled->position, scrolled->delta > 0 ? ZOOM_STEP : 1.0f / ZOOM_STEP);
+    }
+    else if (const auto* pressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+        if (pressed->button == sf::Mouse::Button::Left) {
+            dragging = true;
+            lastMouse = pressed->position;
+        }
+    }
+    else if (const auto* released = event.getIf<sf::Event::MouseButtonReleased>()) {
+        if (released->button == sf::Mouse::Button::Left)
+            dragging = false;
+    }
+    else if (const auto* moved = event.getIf<sf::Event::MouseMoved>()) {
+        if (dragging) {
+            current.move(sf::Vector2f(lastMouse - moved->position) / scale());
+            lastMouse = moved->position;
+            clamp();
+        }
+    }
+    else if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        if (keyPressed->code == sf::Keyboard::Key::R)
+            reset();
+    }
+}
+
+// Le point du monde sous le curseur reste sous le curseur
+void Camera::zoomAt(sf::Vector2i pixel, float factor) {
+    const sf::Vector2f anchor = screenToWorld(pixel);
+    const float newScale = std::clamp(scale() * factor, minScale(), MAX_SCALE);
+
+    current.setSize(screenSize / newScale);
+    current.setCenter(anchor - (sf::Vector2f(pixel) - screenSize / 2.0f) / newScale);
+    clamp();
+}
+
+// Garde la vue dans la carte (centrée sur un axe où elle est plus grande)
+void Camera::clamp() {
+    const sf::Vector2f half = current.getSize() / 2.0f;
+    sf::Vector2f center = current.getCenter();
+
+    center.x = half.x * 2.0f >= worldSize.x ? worldSize.x / 2.0f
+                                            : std::clamp(center.x, half.x, worldSize.x - half.x);
+    center.y = half.y * 2.0f >= worldSize.y ? worldSize.y / 2.0f
+                                            : std::clamp(center.y, half.y, worldSize.y - half.y);
+    current.setCenter(center);
+}
@@ -0,0 +1,43 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+#include <SFML/Graphics.hpp>
+#include <SFML/Window.hpp>
+
+// ============================================================================
+// CAMERA - Vue déplaçable et zoomable sur le monde
+// ============================================================================
+// Molette: zoom centré sur le curseur. Clic gauche glissé: déplacement.
+// [R]: vue entière. La vue reste dans la carte: au plus loin, le monde entier
+// tient à l'écran; au plus près, MAX_SCALE pixels par unité du monde.
+// scale() (pixels par unité) sert au rendu pour choisir le niveau de détail.
+// ============================================================================
+class Camera {
+public:
+    static constexpr float MAX_SCALE = 8.0f;
+    static constexpr float ZOOM_STEP = 1.2f;   // Facteur par cran de molette
+
+    Camera(sf::Vector2f worldSize, sf::Vector2f screenSize);
+
+    void handleEvent(const sf::Event& event);
+    void reset();
+
+    const sf::View& view() const { return current; }
+    // Rectangle du monde visible à l'écran
+    sf::FloatRect visibleArea() const;
+    float scale() const { return screenSize.x / current.getSize().x; }
+
+private:
+    sf::Vector2f worldSize;
+    sf::Vector2f screenSize;
+    sf::View current;
+
+    bool dragging = false;
+    sf::Vector2i lastMouse;
+
+    float minScale() const;
+    sf::Vector2f screenToWorld(sf::Vector2i pixel) const;
+    void zoomAt(sf::Vector2i pixel, float factor);
+    void clamp();
+};
+
+#endif // CAMERA_H
@@ -0,0 +1,53 @@
+#ifndef COMMANDLINE_H
+#define COMMANDLINE_H
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <climits>
+
+// ============================================================================
+// COMMAND LINE - Lecture stricte des valeurs numériques des options
+// ============================================================================
+// Partagé par main, headless et sweep. Chaque parse() lit TOUT le texte:
+// "abc", "12x", une chaîne vide ou une valeur hors du type rendent false et
+// laissent value inchangée (contrairement à atoi, qui rendrait 0 sans rien
+// dire). Les flottants doivent en plus être finis ("inf", "nan" refusés).
+// L'appelant affiche alors son message et l'usage.
+// ============================================================================
+namespace CommandLine {
+    inline bool parse(const char* text, long long& value) {
+        char* end = nullptr;
+        errno = 0;
+        const long long parsed = std::strtoll(text, &end, 10);
+        if (end == text || *end != '\0' || errno == ERANGE) return false;
+        value = parsed;
+        return true;
+    }
+
+    inline bool parse(const char* text, int& value) {
+        long long parsed = 0;
+        if (!parse(text, parsed) || parsed < INT_MIN || parsed > INT_MAX) return false;
+        value = (int)parsed;
+        return true;
+    }
+
+    // strtoul accepte "-1" (et rend ULONG_MAX): le signe est refusé à part
+    inline bool parse(const char* text, uint32_t& value) {
+        long long parsed = 0;
+        if (!parse(text, parsed) || parsed < 0 || parsed > UINT32_MAX) return false;
+        value = (uint32_t)parsed;
+        return true;
+    }
+
+    inline bool parse(const char* text, float& value) {
+        char* end = nullptr;
+        errno = 0;
+        const float parsed = std::strtof(text, &end);
+        if (end == text || *end != '\0' || errno == ERANGE || !std::isfinite(parsed)) return false;
+        value = parsed;
+        return true;
+    }
+}
+
+#endif // COMMANDLINE_H
@@ -8,34 +8,57 @@
 #include "neuralnetwork.h"
 #include "terraintype.h"
 #include "survivallogic.h"
+#include "spatialgrid.h"
+#include "foodindex.h"
+#include "entitystore.h"
+#include "worldconfig.h"
 
 class Prey;
 class Predator;
 //===========ENTITE DE BASE==========
+// Les champs chauds (pos, vel, acc, energy, age...) vivent dans les colonnes
+// d'un EntityStore; l'entité n'en garde qu'un handle et les données froides.
+// La physique est faite en bloc par EntityStore::integrate.
+// Le cerveau est dans la classe dérivée: chaque espèce choisit sa topologie.
 class Entity {
 public:
-    sf::Vector2f pos, vel, acc;  // Added acceleration
+    EntityHandle handle;
     float radius;
-    float maxSpeed;  // Max speed constraint
     sf::Color color;
-    std::unique_ptr<NeuralNetwork> brain;
-    float energy;
     float fitness;
     int generation;
-    int age;
-    float timeSinceLastMeal;
+    uint32_t id;   // Unique dans sa simulation: clé de ses flux aléatoires
 
-    Entity(float x, float y, float r, sf::Color c, int in, int hid, int out);
+    Entity(EntityStore& store, float x, float y, float r, sf::Color c, float speedLimit);
 
-    virtual ~Entity() = default;
+    // Libère le slot dans le store (qui doit donc survivre à l'entité)
+    virtual ~Entity();
 
-    void update(float dt, float width, float height, const std::vector<TerrainTile>& terrain);
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete;
 
-    void draw(sf::RenderWindow& window, bool showDirection) const;
+    // ========== ACCÈS AUX COLONNES ==========
+    sf::Vector2f& pos() { return handle.pos(); }
+    sf::Vector2f& vel() { return handle.vel(); }
+    sf::Vector2f& acc() { return handle.acc(); }
+    float& energy() { return handle.energy(); }
+    float& maxSpeed() { return handle.maxSpeed(); }
+    float& timeSinceLastMeal() { return handle.timeSinceLastMeal(); }
+    int& age() { return handle.age(); }
 
-    float distanceTo(const Entity& other) const;
+    // Lecture seule sur une entité const
+    const sf::Vector2f& pos() const { return handle.pos(); }
+    const sf::Vector2f& vel() const { return handle.vel(); }
+    const sf::Vector2f& acc() const { return handle.acc(); }
+    float energy() const { return handle.energy(); }
+    float maxSpeed() const { return handle.maxSpeed(); }
+    float timeSinceLastMeal() const { return handle.timeSinceLastMeal(); }
+    int age() const { return handle.age(); }
 
-    float distanceTo(const sf::Vector2f& point) const;
+    // Distances sur le tore de dimensions world
+    float distanceTo(const Entity& other, const WorldConfig& world) const;
+
+    float distanceTo(const sf::Vector2f& point, const WorldConfig& world) const;
 
     bool isDead() const;
 };
@@ -43,10 +66,24 @@ public:
 class Prey : public Entity {
 public:
     static constexpr float DETECTION_RADIUS = 80.0f;
+    static constexpr float RADIUS = 5.0f;
+    static constexpr float EAT_RADIUS = 10.0f;
+
+    // 8 entrées (sense) -> 20 neurones cachés -> 2 sorties (act)
+    using Brain = NeuralNetwork<8, 20, 2>;
+    static_assert(Brain::InputSize == 8 && Brain::OutputSize == 2, "sense() écrit 8 entrées, act() lit 2 sorties");
+    Brain brain;
 
-    Prey(float x, float y);
+    // Cerveau aux poids tirés dans rng, ou copie d'un cerveau existant (enfant)
+    Prey(EntityStore& store, float x, float y, RandomStream& rng);
+    Prey(EntityStore& store, float x, float y, const Brain& brain);
 
-    void think(const std::vector<std::unique_ptr<Predator>>& predators, const std::vector<std::unique_ptr<Food>>& foods);
+    // Perception: met à jour le fitness et écrit les 8 entrées du réseau
+    // (les voisins sont cherchés dans les index spatiaux tenus par Simulation,
+    // les directions sont normalisées par les dimensions du monde)
+    void sense(const SpatialGrid& predatorGrid, const FoodIndex& foods, const WorldConfig& world, float* inputs);
+    // Action: applique les 2 sorties du réseau (angle, poussée)
+    void act(const float* outputs);
 };
 
 // ============ PRÉDATEUR ============
@@ -55,9 +92,14 @@ public:
     static constexpr float DETECTION_RADIUS = 100.0f;
     static constexpr float HUNGER_RADIUS = 250.0f;
     static constexpr float STARVATION_TIME = 20.0f;
+    using Brain = NeuralNetwork<8, 20, 2>;
+    static_assert(Brain::InputSize == 8 && Brain::OutputSize == 2, "sense() écrit 8 entrées, act() lit 2 sorties");
+    Brain brain;
     int kills;
-    Predator(float x, float y);
-    void think(const std::vector<std::unique_ptr<Prey>>& preys);
+    Predator(EntityStore& store, float x, float y, RandomStream& rng);
+    Predator(EntityStore& store, float x, float y, const Brain& brain);
+    void sense(const SpatialGrid& preyGrid, const WorldConfig& world, float* inputs);
+    void act(const float* outputs);
     bool isStarving() const;
     bool isHungry() const;
 };
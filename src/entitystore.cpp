@@ -0,0 +1,125 @@
+#include "entitystore.h"
+#include <cmath>
+
+uint32_t EntityStore::allocate(sf::Vector2f position, float speedLimit) {
+    uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = (uint32_t)pos.size();
+        pos.emplace_back();
+        vel.emplace_back();
+        nextPos.emplace_back();
+        nextVel.emplace_back();
+        acc.emplace_back();
+        energy.emplace_back();
+        maxSpeed.emplace_back();
+        timeSinceLastMeal.emplace_back();
+        age.emplace_back();
+        alive.emplace_back();
+        // freeSlots ne peut pas dépasser le nombre de slots: avec la même
+        // capacité que les colonnes, release() (une mort en plein tick)
+        // n'alloue jamais
+        if (freeSlots.capacity() < pos.capacity())
+            freeSlots.reserve(pos.capacity());
+    }
+
+    // Les deux tampons: l'entité peut naître en plein tick (évolution)
+    pos[slot] = nextPos[slot] = position;
+    vel[slot] = nextVel[slot] = sf::Vector2f(0, 0);
+    acc[slot] = sf::Vector2f(0, 0);
+    energy[slot] = 100;
+    maxSpeed[slot] = speedLimit;
+    timeSinceLastMeal[slot] = 1;
+    age[slot] = 0;
+    alive[slot] = 1;
+    return slot;
+}
+
+void EntityStore::release(uint32_t slot) {
+    // Un slot libre reste dans les colonnes mais ne bouge plus
+    alive[slot] = 0;
+    vel[slot] = nextVel[slot] = sf::Vector2f(0, 0);
+    acc[slot] = sf::Vector2f(0, 0);
+    freeSlots.push_back(slot);
+}
+
+// ============================================================================
+// INTEGRATE - GESTION PHYSIQUE DU MOUVEMENT
+// ============================================================================
+// Système physique basé sur l'accélération: le cerveau neuronal contrôle
+// l'ACCÉLÉRATION (écrite par think()), pas directement la vitesse.
+// La boucle ne lit que les colonnes et n'a pas de branche dépendant de
+// l'entité (les conditions sont des sélections): le compilateur peut la
+// vectoriser. Entrées (pos, vel) et sorties (nextPos, nextVel) sont des
+// tableaux distincts, sans aliasing. Les slots libres ont vitesse et
+// accélération nulles: ils restent sur place. Leur âge, leur faim et leur
+// énergie sont figés par le masque alive (une multiplication, pas une
+// branche): un slot libre très longtemps ne dérive pas jusqu'au débordement
+// de son compteur d'âge, et allocate() le retrouve tel que release() l'a
+// laissé.
+//
+// TERRAIN DISABLED: les collisions et effets du terrain restent désactivés
+// pour se concentrer sur les problèmes de vitesse et de cycling.
+// ============================================================================
+void EntityStore::integrate(float dt, float width, float height, size_t begin, size_t end) {
+    const sf::Vector2f* __restrict const p = pos.data();
+    const sf::Vector2f* __restrict const v = vel.data();
+    sf::Vector2f* __restrict const np = nextPos.data();
+    sf::Vector2f* __restrict const nv = nextVel.data();
+    sf::Vector2f* const a = acc.data();
+    float* const e = energy.data();
+    const float* const vmax = maxSpeed.data();
+    float* const hunger = timeSinceLastMeal.data();
+    int* const ages = age.data();
+    const char* const live = alive.data();
+
+    for (size_t i = begin; i < end; ++i) {
+        // 1 pour un slot occupé, 0 pour un slot libre
+        const int occupied = live[i];
+        const float occupiedF = (float)occupied;
+
+        // ========== VIEILLISSEMENT ==========
+        ages[i] += occupied;
+        hunger[i] += dt * occupiedF;
+
+        // ========== ACCÉLÉRATION PUIS FRICTION (2% par frame) ==========
+        float vx = (v[i].x + a[i].x * dt) * 0.98f;
+        float vy = (v[i].y + a[i].y * dt) * 0.98f;
+
+        // ========== LIMITER LA VITESSE MAXIMALE ==========
+        const float speed = std::sqrt(vx * vx + vy * vy);
+        const float scale = speed > vmax[i] ? vmax[i] / speed : 1.0f;
+        vx *= scale;
+        vy *= scale;
+
+        // ========== SEUIL DE VITESSE MINIMALE ==========
+        // Sous 1.0 on considère l'entité immobile (évite les micro-mouvements).
+        // Ne PAS mettre ce seuil trop haut, sinon les entités ne démarrent jamais
+        const float moving = speed < 1.0f ? 0.0f : 1.0f;
+        vx *= moving;
+        vy *= moving;
+
+        nv[i].x = vx;
+        nv[i].y = vy;
+
+        // L'accélération est réappliquée par think() à chaque frame
+        a[i].x = 0;
+        a[i].y = 0;
+
+        // ========== APPLIQUER LA VITESSE À LA POSITION ==========
+        float px = p[i].x + vx * dt;
+        float py = p[i].y + vy * dt;
+
+        // ========== BORDS DE LA CARTE (WRAP-AROUND) ==========
+        // Si l'entité sort par un bord, elle réapparaît de l'autre côté
+        px = px <= 0 ? width - 4.0f : (px >= width ? 4.0f : px);
+        py = py <= 0 ? height - 4.0f : (py >= height ? 4.0f : py);
+        np[i].x = px;
+        np[i].y = py;
+
+        // Coût énergétique de base (métabolisme)
+        e[i] -= 0.01f * dt * occupiedF;
+    }
+}
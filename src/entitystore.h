@@ -0,0 +1,86 @@
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+#include <SFML/System.hpp>
+#include <vector>
+#include <cstdint>
+
+// ============================================================================
+// ENTITY STORE - Stockage en colonnes (structure of arrays) des entités
+// ============================================================================
+// Les champs lus/écrits à chaque tick (position, vitesse, accélération,
+// énergie, âge...) sont rangés dans des tableaux contigus, un par champ.
+// Chaque entité occupe un "slot" stable pour toute sa vie: les slots libérés
+// sont recyclés, l'ordre des proies/prédateurs dans Simulation n'a donc pas
+// à suivre celui des colonnes. La physique (integrate) parcourt les colonnes
+// linéairement, sans passer par les objets Entity.
+//
+// Position et vitesse sont en double tampon: pendant un tick, tout le monde
+// lit pos/vel (l'état à la fin du tick précédent) et integrate écrit
+// nextPos/nextVel. swapBuffers(), en fin de Simulation::update, publie le
+// nouvel état. Aucune phase ne voit donc une position à moitié mise à jour:
+// l'ordre de traitement des entités ne change rien au résultat.
+// ============================================================================
+class EntityStore {
+public:
+    // ========== COLONNES CHAUDES (indexées par slot) ==========
+    std::vector<sf::Vector2f> pos, vel;          // État courant (lu pendant le tick)
+    std::vector<sf::Vector2f> nextPos, nextVel;  // État suivant (écrit par integrate)
+    std::vector<sf::Vector2f> acc;
+    std::vector<float> energy;
+    std::vector<float> maxSpeed;
+    std::vector<float> timeSinceLastMeal;
+    std::vector<int> age;
+    std::vector<char> alive;
+
+    // Réserve un slot (recyclé si possible) initialisé pour une nouvelle entité
+    uint32_t allocate(sf::Vector2f position, float speedLimit);
+    void release(uint32_t slot);
+
+    size_t capacity() const { return pos.size(); }
+    size_t size() const { return pos.size() - freeSlots.size(); }
+
+    // Physique de tous les slots vivants (remplace l'ancien Entity::update):
+    // lit pos/vel, écrit nextPos/nextVel
+    void integrate(float dt, float width, float height) { integrate(dt, width, height, 0, capacity()); }
+    // Idem sur les slots [begin, end) seulement (un bloc du TaskScheduler)
+    void integrate(float dt, float width, float height, size_t begin, size_t end);
+
+    // L'état suivant devient l'état courant
+    void swapBuffers() {
+        pos.swap(nextPos);
+        vel.swap(nextVel);
+    }
+
+private:
+    std::vector<uint32_t> freeSlots;
+};
+
+// ============================================================================
+// ENTITY HANDLE - Référence (store, slot) vers les colonnes d'une entité
+// ============================================================================
+// Reste valide quand les colonnes grandissent (contrairement à un pointeur).
+// ============================================================================
+struct EntityHandle {
+    EntityStore* store = nullptr;
+    uint32_t slot = 0;
+
+    // Un handle const ne donne que la lecture: la constness de l'entité
+    // (const Entity&) s'étend ainsi à ses colonnes
+    sf::Vector2f& pos() { return store->pos[slot]; }
+    sf::Vector2f& vel() { return store->vel[slot]; }
+    sf::Vector2f& acc() { return store->acc[slot]; }
+    float& energy() { return store->energy[slot]; }
+    float& maxSpeed() { return store->maxSpeed[slot]; }
+    float& timeSinceLastMeal() { return store->timeSinceLastMeal[slot]; }
+    int& age() { return store->age[slot]; }
+
+    const sf::Vector2f& pos() const { return store->pos[slot]; }
+    const sf::Vector2f& vel() const { return store->vel[slot]; }
+    const sf::Vector2f& acc() const { return store->acc[slot]; }
+    float energy() const { return store->energy[slot]; }
+    float maxSpeed() const { return store->maxSpeed[slot]; }
+    float timeSinceLastMeal() const { return store->timeSinceLastMeal[slot]; }
+    int age() const { return store->age[slot]; }
+};
+
+#endif // ENTITYSTORE_H
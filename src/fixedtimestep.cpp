@@ -0,0 +1,36 @@
+#include "fixedtimestep.h"
+#include <algorithm>
+
+FixedTimestep::FixedTimestep(float step, int maxSubsteps)
+    : stepSize(step), maxSubsteps(maxSubsteps) {}
+
+int FixedTimestep::beginFrame(float realDt, float rate) {
+    // La mesure du ratio voit le vrai temps écoulé: une frame bloquée fait
+    // bien baisser la vitesse obtenue affichée
+    windowReal += realDt;
+
+    // Une frame anormalement longue (fenêtre déplacée, point d'arrêt...)
+    // ne doit pas déclencher une rafale de rattrapage
+    accumulator += (double)std::min(realDt, 0.25f) * rate;
+    requested = std::min((int)(accumulator / stepSize), maxSubsteps);
+    accumulator -= requested * (double)stepSize;
+
+    // Plafond atteint: on ne garde pas plus d'un pas de retard
+    if (requested == maxSubsteps)
+        accumulator = std::min(accumulator, (double)stepSize);
+    return requested;
+}
+
+void FixedTimestep::endFrame(int stepsRun) {
+    windowSimulated += stepsRun * (double)stepSize;
+
+    // Pas non joués (budget temps dépassé): leur temps est perdu
+    if (stepsRun < requested)
+        accumulator = std::min(accumulator, (double)stepSize);
+
+    if (windowReal >= 0.5) {
+        ratio = (float)(windowSimulated / windowReal);
+        windowReal = 0;
+        windowSimulated = 0;
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+// ============================================================================
+// FIXED TIMESTEP - Boucle à pas fixe avec accélération
+// ============================================================================
+// La simulation avance toujours du même pas (step), quelle que soit la
+// durée réelle des frames: la physique reste identique à 1x comme à 100x.
+// Chaque frame, le temps réel écoulé multiplié par la vitesse demandée
+// s'ajoute à un accumulateur, et beginFrame() rend le nombre de pas entiers
+// à simuler.
+//
+// Anti "spiral of death": si la machine ne suit pas, le retard n'est pas
+// reporté indéfiniment. Au plus maxSubsteps pas par frame, et endFrame()
+// jette le temps des pas qui n'ont pas pu être joués (budget dépassé). La
+// vitesse réellement obtenue est mesurée (achievedRatio) pour l'affichage.
+// ============================================================================
+class FixedTimestep {
+public:
+    FixedTimestep(float step, int maxSubsteps);
+
+    // Nombre de pas à simuler pour cette frame
+    int beginFrame(float realDt, float rate);
+
+    // Pas réellement joués (<= beginFrame): le reste du retard est abandonné
+    void endFrame(int stepsRun);
+
+    float step() const { return stepSize; }
+
+    // Temps simulé / temps réel, mesuré sur la dernière demi-seconde
+    float achievedRatio() const { return ratio; }
+
+private:
+    float stepSize;
+    int maxSubsteps;
+    double accumulator = 0;
+    int requested = 0;
+
+    // Fenêtre de mesure du ratio
+    double windowReal = 0;
+    double windowSimulated = 0;
+    float ratio = 0;
+};
+
+#endif // FIXEDTIMESTEP_H
@@ -0,0 +1,66 @@
+#include "foodindex.h"
+#include <cmath>
+#include <limits>
+
+FoodIndex::FoodIndex(float width, float height, float cellSize)
+    : GridLayout(width, height, cellSize),
+      head(cols * rows, -1) {}
+
+void FoodIndex::add(const Food& food) {
+    int k;
+    if (freeList >= 0) {
+        k = freeList;
+        freeList = next[k];
+        pool[k] = food;
+    } else {
+        k = (int)pool.size();
+        pool.push_back(food);
+        next.push_back(-1);
+    }
+    pool[k].pos = Torus::wrap(food.pos, width, height);
+
+    const int c = cellOf(pool[k].pos);
+    next[k] = head[c];
+    head[c] = k;
+    ++count;
+}
+
+void FoodIndex::reserve(size_t capacity) {
+    pool.reserve(capacity);
+    next.reserve(capacity);
+}
+
+// Même parcours par anneaux que SpatialGrid::nearest
+SpatialGrid::Hit FoodIndex::nearest(sf::Vector2f center) const {
+    SpatialGrid::Hit best;
+    if (count == 0) return best;
+
+    const int cx = cellX(center.x);
+    const int cy = cellY(center.y);
+    float bestD2 = std::numeric_limits<float>::max();
+
+    for (int r = 0; r <= maxRing(); ++r) {
+        if (best.index >= 0) {
+            const float bound = ringBound(r);
+            if (bound > 0 && bound * bound >= bestD2) break;
+        }
+
+        forEachCellInRing(cx, cy, r, [&](int c) {
+            for (int k = head[c]; k >= 0; k = next[k]) {
+                const Food& food = pool[k];
+                const sf::Vector2f d = delta(center, food.pos);
+                const float d2 = d.x * d.x + d.y * d.y;
+                if (d2 < bestD2) {
+                    bestD2 = d2;
+                    best.index = c;
+                    best.pos = food.pos;
+                    best.delta = d;
+                }
+            }
+        });
+    }
+
+    if (best.index >= 0)
+        best.distance = std::sqrt(bestD2);
+    return best;
+}
@@ -0,0 +1,88 @@
+#ifndef FOODINDEX_H
+#define FOODINDEX_H
+#include "survivallogic.h"
+#include "spatialgrid.h"
+#include <vector>
+
+// ============================================================================
+// FOOD INDEX - Nourriture rangée par cellule
+// ============================================================================
+// Contrairement à SpatialGrid (reconstruite à chaque tick), la nourriture
+// change peu: chaque Food est chaînée dans la liste de sa cellule à l'ajout
+// et en est retirée dès qu'elle est mangée. "Qu'est-ce que je peux manger
+// ici ?" ne lit que les cellules voisines, quelle que soit la quantité
+// totale de nourriture.
+//
+// Les Food vivent dans un pool unique: les cases libérées sont recyclées
+// par add(), qui n'alloue que lorsque la nourriture dépasse son plus haut
+// niveau (croissance par doublement) ou la place prévue par reserve().
+//
+// add() ramène la position sur le tore: une Food posée hors de la carte
+// (prairie qui déborde) est rangée à son image dans la carte, dans la
+// cellule qui la contient vraiment. Sinon la cellule bornée par cellOf ne
+// serait pas celle que parcourent les anneaux autour d'une proie, et la
+// Food resterait visible par nearest() sans jamais pouvoir être mangée.
+// ============================================================================
+class FoodIndex : private GridLayout {
+public:
+    FoodIndex(float width, float height, float cellSize);
+
+    void add(const Food& food);
+    // Prévoit la place de count Food (add n'alloue pas en dessous)
+    void reserve(size_t count);
+    size_t size() const { return count; }
+
+    // Nourriture la plus proche (Hit::index = cellule qui la contient)
+    SpatialGrid::Hit nearest(sf::Vector2f center) const;
+
+    // Retire toute la nourriture à moins de radius et appelle onEat(food)
+    // pour chacune. Retourne le nombre de Food mangées.
+    template <typename Fn>
+    int consumeInRadius(sf::Vector2f center, float radius, Fn&& onEat);
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (int first : head)
+            for (int k = first; k >= 0; k = next[k])
+                fn(pool[k]);
+    }
+
+private:
+    std::vector<Food> pool;   // Toutes les Food (cases libres comprises)
+    std::vector<int> next;    // Suivante dans la même liste (-1 = fin)
+    std::vector<int> head;    // Première Food de chaque cellule (-1 = vide)
+    int freeList = -1;        // Liste des cases libres du pool
+    size_t count = 0;
+};
+
+template <typename Fn>
+int FoodIndex::consumeInRadius(sf::Vector2f center, float radius, Fn&& onEat) {
+    const int cx = cellX(center.x);
+    const int cy = cellY(center.y);
+    const float r2 = radius * radius;
+    int eaten = 0;
+
+    for (int r = 0; r <= maxRing() && ringBound(r) < radius; ++r) {
+        forEachCellInRing(cx, cy, r, [&](int c) {
+            int* link = &head[c];
+            while (*link >= 0) {
+                const int k = *link;
+                const sf::Vector2f d = delta(center, pool[k].pos);
+                if (d.x * d.x + d.y * d.y < r2) {
+                    onEat(pool[k]);
+                    // Décrocher k de la cellule et le rendre au pool
+                    *link = next[k];
+                    next[k] = freeList;
+                    freeList = k;
+                    --count;
+                    ++eaten;
+                } else {
+                    link = &next[k];
+                }
+            }
+        });
+    }
+    return eaten;
+}
+
+#endif // FOODINDEX_H
@@ -4,8 +4,7 @@
 #include <SFML/System.hpp>
 #include <vector>
 #include <algorithm>
-#include <sstream>
-#include <iomanip>
+#include <cstdio>
 #include <iostream>
 #include <deque>
 
@@ -14,13 +13,15 @@
 
 // ============ GRAPHIQUE DE FITNESS ============
 void GUI::FitnessGraph::addData(float preyAvg, float predAvg) {
-    preyFitness.push_back(preyAvg);
-    predatorFitness.push_back(predAvg);
-
-    if (preyFitness.size() > MAX_POINTS)
-        preyFitness.pop_front();
-    if (predatorFitness.size() > MAX_POINTS)
-        predatorFitness.pop_front();
+    // Fenêtre pleine: le nouveau point écrase le plus ancien
+    const size_t slot = (oldest + count) % MAX_POINTS;
+    preyFitness[slot] = preyAvg;
+    predatorFitness[slot] = predAvg;
+
+    if (count < MAX_POINTS)
+        ++count;
+    else
+        oldest = (oldest + 1) % MAX_POINTS;
 }
 
 void GUI::FitnessGraph::draw(sf::RenderWindow& window, const sf::Font& font) const {
@@ -43,24 +44,24 @@ void GUI::FitnessGraph::draw(sf::RenderWindow& window, const sf::Font& font) con
     title.setFillColor(sf::Color::White);
     window.draw(title);
 
-    if (preyFitness.empty()) return;
+    if (count == 0) return;
 
     float maxFitness = 1.0f;
-    for (float f : preyFitness)
-        maxFitness = std::max(maxFitness, f);
-    for (float f : predatorFitness)
-        maxFitness = std::max(maxFitness, f);
+    for (size_t i = 0; i < count; ++i) {
+        maxFitness = std::max(maxFitness, preyFitness[i]);
+        maxFitness = std::max(maxFitness, predatorFitness[i]);
+    }
 
     const float plotY = graphY + 25.0f;
     const float plotHeight = graphHeight - 30.0f;
 
-    auto drawCurve = [&](const std::deque<float>& data, sf::Color color) {
-        if (data.size() < 2) return;
+    auto drawCurve = [&](const std::array<float, MAX_POINTS>& data, sf::Color color) {
+        if (count < 2) return;
 
         std::vector<sf::Vertex> vertices;
-        for (size_t i = 0; i < data.size(); ++i) {
+        for (size_t i = 0; i < count; ++i) {
             float x = graphX + (i * graphWidth / MAX_POINTS);
-            float normalizedFitness = data[i] / maxFitness;
+            float normalizedFitness = data[(oldest + i) % MAX_POINTS] / maxFitness;
             float y = plotY + plotHeight - (normalizedFitness * plotHeight);
             vertices.push_back(sf::Vertex{{x, y}, color});
         }
@@ -75,37 +76,26 @@ void GUI::FitnessGraph::draw(sf::RenderWindow& window, const sf::Font& font) con
 void GUI::DebugMonitor::draw(sf::RenderWindow& window, const sf::Font& font) const {
     if (!enabled) return;
 
-    const float debugX = 10.0f;
-    const float debugY = 550.0f;
-    const float debugWidth = 300.0f;
-    const float debugHeight = 240.0f;
-
-    sf::RectangleShape bg({debugWidth, debugHeight});
-    bg.setPosition({debugX, debugY});
+    sf::RectangleShape bg({PANEL_WIDTH, PANEL_HEIGHT});
+    bg.setPosition({PANEL_X, PANEL_Y});
     bg.setFillColor(sf::Color(20, 20, 30, 220));
     bg.setOutlineColor(sf::Color::Cyan);
     bg.setOutlineThickness(2);
     window.draw(bg);
 
-    sf::Text title(font);
-    title.setString("=== DEBUG MONITOR ===");
-    title.setCharacterSize(12);
-    title.setPosition({debugX + 5, debugY + 5});
-    title.setFillColor(sf::Color::Cyan);
-    window.draw(title);
+    titleText.setString(font, "=== DEBUG MONITOR ===");
+    titleText.draw(window);
 
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(3);
+    // Tampon réutilisé: pas d'allocation une fois la capacité atteinte
+    valuesBuffer.clear();
+    char line[128];
     for (const auto& [name, value] : values) {
-        ss << name << ": " << value << "\n";
+        std::snprintf(line, sizeof(line), "%s: %.3f\n", name.c_str(), value);
+        valuesBuffer += line;
     }
 
-    sf::Text debugText(font);
-    debugText.setString(ss.str());
-    debugText.setCharacterSize(10);
-    debugText.setPosition({debugX + 5, debugY + 25});
-    debugText.setFillColor(sf::Color::White);
-    window.draw(debugText);
+    valuesText.setString(font, valuesBuffer);
+    valuesText.draw(window);
 }
 
 // ============ GUI CONTROLS ============
@@ -136,39 +126,37 @@ void GUI::GUIControls::update() {
 void GUI::GUIControls::draw(sf::RenderWindow& window, const sf::Font& font) {
     // IMPORTANT: Ne JAMAIS réinitialiser les valeurs ici
     // Les valeurs sont SEULEMENT modifiées dans handleInput()
-    const float guiX = res_width - 220;
-    const float guiY = 10;
-
-    sf::RectangleShape bg({210, 240});
-    bg.setPosition({guiX, guiY});
+    sf::RectangleShape bg({PANEL_WIDTH, PANEL_HEIGHT});
+    bg.setPosition({PANEL_X, PANEL_Y});
     bg.setFillColor(sf::Color(30, 30, 40, 200));
     bg.setOutlineColor(sf::Color::White);
     bg.setOutlineThickness(1);
     window.draw(bg);
 
-    sf::Text title(font);
-    title.setString("=== CONTROLES ===");
-    title.setCharacterSize(12);
-    title.setPosition({guiX + 10, guiY + 5});
-    title.setFillColor(sf::Color::Yellow);
-    window.draw(title);
-
-    std::stringstream ss;
-    ss << "\n[D] Detection: " << (showDetectionRadius ? "ON" : "OFF")
-       << "\n[L] Lignes: " << (showDirectionLines ? "ON" : "OFF")
-       << "\n[V] Vitesse: " << (showAverageSpeed ? "ON" : "OFF")
-       << "\n\n[<-/->] Mutation: " << std::fixed << std::setprecision(2) << mutationRate
-       << "\n[UP/DOWN] Gen Time: " << (int)generationTime << "s"
-       << "\n[Q/W] Fast Forward: " << std::fixed << std::setprecision(1) << fastForwardRate << "x"
-       << "\n\n[F1] Debug Monitor: " << (debugMonitor.isEnabled() ? "ON" : "OFF")
-       ;
-
-    sf::Text controls(font);
-    controls.setString(ss.str());
-    controls.setCharacterSize(10);
-    controls.setPosition({guiX + 10, guiY + 25});
-    controls.setFillColor(sf::Color::White);
-    window.draw(controls);
+    titleText.setString(font, "=== CONTROLES ===");
+    titleText.draw(window);
+
+    char text[512];
+    std::snprintf(text, sizeof(text),
+                  "\n[D] Detection: %s"
+                  "\n[L] Lignes: %s"
+                  "\n[V] Vitesse: %s"
+                  "\n\n[<-/->] Mutation: %.2f"
+                  "\n[UP/DOWN] Gen Time: %ds"
+                  "\n[Q/W] Fast Forward: %.1fx (reel: %.1fx)"
+                  "\n\n[F1] Debug Monitor: %s"
+                  "\n\n[Molette] Zoom  [Clic] Deplacer"
+                  "\n[R] Vue entiere",
+                  showDetectionRadius ? "ON" : "OFF",
+                  showDirectionLines ? "ON" : "OFF",
+                  showAverageSpeed ? "ON" : "OFF",
+                  mutationRate,
+                  (int)generationTime,
+                  fastForwardRate, achievedSpeed,
+                  debugMonitor.isEnabled() ? "ON" : "OFF");
+
+    controlsText.setString(font, text);
+    controlsText.draw(window);
 
     // Dessiner le debug monitor
     debugMonitor.draw(window, font);
@@ -205,10 +193,13 @@ void GUI::GUIControls::handleInput(sf::Keyboard::Key key) {
         generationTime = std::max(10.0f, generationTime - 5.0f);
     }
     // FAST FORWARD: Touches Q/W seulement
+    // Pas de 1 jusqu'à 10x, de 10 jusqu'à 100x, puis de 100 jusqu'à 1000x
     else if (key == sf::Keyboard::Key::W) {
-        fastForwardRate = std::min(100.0f, fastForwardRate + 1.0f);
+        const float step = fastForwardRate < 10.0f ? 1.0f : fastForwardRate < 100.0f ? 10.0f : 100.0f;
+        fastForwardRate = std::min(1000.0f, fastForwardRate + step);
     }
     else if (key == sf::Keyboard::Key::Q) {
-        fastForwardRate = std::max(1.0f, fastForwardRate - 1.0f);
+        const float step = fastForwardRate <= 10.0f ? 1.0f : fastForwardRate <= 100.0f ? 10.0f : 100.0f;
+        fastForwardRate = std::max(1.0f, fastForwardRate - step);
     }
 }
@@ -3,7 +3,9 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
+#include "textoverlay.h"
 #include <deque>
+#include <array>
 #include <string>
 #include <map>
 
@@ -16,9 +18,12 @@ public:
     //================================
     class FitnessGraph {
     private:
-        std::deque<float> preyFitness;
-        std::deque<float> predatorFitness;
         static constexpr size_t MAX_POINTS = 100;
+        // Fenêtre glissante en tampon circulaire: addData n'alloue jamais
+        std::array<float, MAX_POINTS> preyFitness{};
+        std::array<float, MAX_POINTS> predatorFitness{};
+        size_t oldest = 0;  // Indice du point le plus ancien
+        size_t count = 0;
 
     public:
         void addData(float preyAvg, float predAvg);
@@ -33,6 +38,17 @@ public:
         std::map<std::string, float> values;
         bool enabled;
 
+        // Coin haut gauche et taille du panneau: les textes s'y placent
+        static constexpr float PANEL_X = 10.0f;
+        static constexpr float PANEL_Y = 550.0f;
+        static constexpr float PANEL_WIDTH = 300.0f;
+        static constexpr float PANEL_HEIGHT = 240.0f;
+
+        // Textes mis en page seulement quand les valeurs affichées changent
+        mutable CachedText titleText{12, {PANEL_X + 5.0f, PANEL_Y + 5.0f}, sf::Color::Cyan};
+        mutable CachedText valuesText{10, {PANEL_X + 5.0f, PANEL_Y + 25.0f}, sf::Color::White};
+        mutable std::string valuesBuffer;
+
     public:
         DebugMonitor() : enabled(false) {}
 
@@ -42,6 +58,7 @@ public:
         void setValue(const std::string& name, float value) {
             values[name] = value;
         }
+        const std::map<std::string, float>& getValues() const { return values; }
 
         void draw(sf::RenderWindow& window, const sf::Font& font) const;
     };
@@ -59,6 +76,10 @@ public:
         float generationTime;
         float fastForwardRate;
 
+        // Vitesse réellement obtenue (temps simulé / temps réel), mesurée
+        // par la boucle principale: affichage seulement
+        float achievedSpeed;
+
         // Debug monitor
         DebugMonitor debugMonitor;
 
@@ -68,6 +89,16 @@ public:
         float lastGenerationTime;
         float lastFastForwardRate;
 
+        // Coin haut gauche et taille du panneau: les textes s'y placent
+        static constexpr float PANEL_X = res_width - 220.0f;
+        static constexpr float PANEL_Y = 10.0f;
+        static constexpr float PANEL_WIDTH = 210.0f;
+        static constexpr float PANEL_HEIGHT = 240.0f;
+
+        // Textes du panneau, mis en page seulement quand ils changent
+        CachedText titleText{12, {PANEL_X + 10.0f, PANEL_Y + 5.0f}, sf::Color::Yellow};
+        CachedText controlsText{10, {PANEL_X + 10.0f, PANEL_Y + 25.0f}, sf::Color::White};
+
         GUIControls()
             : showDetectionRadius(true),
               showAverageSpeed(false),
@@ -75,6 +106,7 @@ public:
               mutationRate(0.15f),
               generationTime(30.0f),
               fastForwardRate(1.0f),
+              achievedSpeed(0.0f),
               frameCount(0),
               lastMutationRate(0.15f),
               lastGenerationTime(30.0f),
@@ -0,0 +1,275 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include "gui.h"
+#include "simulation.h"
+#include "islandmodel.h"
+#include "commandline.h"
+
+// ============================================================================
+// HEADLESS - Simulation sans fenêtre, à pleine vitesse
+// ============================================================================
+// Pour les longues évolutions sur serveur (pas d'écran): aucune fenêtre,
+// police ni appel de dessin. Chaque tick avance d'un pas fixe (1/60 s par
+// défaut, comme une frame de la version graphique) et on enchaîne les ticks
+// sans attendre.
+//
+// Sorties:
+// --stats  CSV d'une ligne par génération (GenerationStats)
+// --final  CSV de l'état final de chaque entité
+//
+// Avec --islands N, N sous-populations évoluent en parallèle et échangent
+// leurs meilleures proies (IslandModel); les CSV ont alors une colonne par
+// île (world pour --stats, island pour --final).
+// ============================================================================
+
+struct HeadlessOptions {
+    SimulationConfig config;
+    long long ticks = 60 * 60 * 30;  // 30 minutes simulées
+    float dt = 1.0f / 60.0f;
+    float mutationRate = -1;         // < 0: valeur par défaut de GUIControls
+    float generationTime = -1;
+    std::string statsPath;
+    std::string finalPath;
+    long long progressEvery = 0;     // 0: pas de suivi
+    int islands = 1;                 // > 1: modèle en îles
+    MigrationConfig migration;
+};
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --seed N              graine (0 = aleatoire, defaut)\n"
+              << "  --ticks N             nombre de ticks (defaut 108000)\n"
+              << "  --dt S                pas de temps en secondes (defaut 1/60)\n"
+              << "  --preys N             proies au depart (defaut 25)\n"
+              << "  --predators N         predateurs au depart (defaut 6)\n"
+              << "  --world-width W       largeur du monde (defaut 800)\n"
+              << "  --world-height H      hauteur du monde (defaut 800)\n"
+              << "  --mutation-rate R     taux de mutation\n"
+              << "  --generation-time S   duree d'une generation en secondes simulees\n"
+              << "  --stats FICHIER       CSV des statistiques par generation\n"
+              << "  --final FICHIER       CSV de l'etat final des entites\n"
+              << "  --progress N          affiche l'avancement tous les N ticks\n"
+              << "                        (avec --islands: en fin d'epoque)\n"
+              << "  --islands N           N iles en parallele avec migration (defaut 1)\n"
+              << "  --migration-interval G  generations entre deux migrations (defaut 5)\n"
+              << "  --migrants N          proies envoyees a l'ile suivante (defaut 2)\n";
+}
+
+// Retourne false (après un message) si la ligne de commande est invalide
+static bool parseOptions(int argc, char** argv, HeadlessOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Option sans valeur: " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+
+        bool ok = true;
+        if (arg == "--seed") ok = CommandLine::parse(value, options.config.seed);
+        else if (arg == "--ticks") ok = CommandLine::parse(value, options.ticks);
+        else if (arg == "--dt") ok = CommandLine::parse(value, options.dt);
+        else if (arg == "--preys") ok = CommandLine::parse(value, options.config.initialPreys);
+        else if (arg == "--predators") ok = CommandLine::parse(value, options.config.initialPredators);
+        else if (arg == "--world-width") ok = CommandLine::parse(value, options.config.world.width);
+        else if (arg == "--world-height") ok = CommandLine::parse(value, options.config.world.height);
+        else if (arg == "--mutation-rate") ok = CommandLine::parse(value, options.mutationRate);
+        else if (arg == "--generation-time") ok = CommandLine::parse(value, options.generationTime);
+        else if (arg == "--stats") options.statsPath = value;
+        else if (arg == "--final") options.finalPath = value;
+        else if (arg == "--progress") ok = CommandLine::parse(value, options.progressEvery);
+        else if (arg == "--islands") ok = CommandLine::parse(value, options.islands);
+        else if (arg == "--migration-interval") ok = CommandLine::parse(value, options.migration.interval);
+        else if (arg == "--migrants") ok = CommandLine::parse(value, options.migration.migrants);
+        else {
+            std::cerr << "Option inconnue: " << arg << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Valeur invalide pour " << arg << ": " << value << "\n";
+            return false;
+        }
+    }
+
+    if (options.ticks < 0 || options.dt <= 0 || options.config.initialPreys < 0 || options.config.initialPredators < 0
+        || options.progressEvery < 0) {
+        std::cerr << "Valeur invalide (ticks, dt, populations et progress doivent etre positifs)\n";
+        return false;
+    }
+    if (!options.config.world.valid()) {
+        std::cerr << "Valeur invalide (le monde doit mesurer au moins " << WorldConfig::MIN_SIZE << " de cote)\n";
+        return false;
+    }
+    if (options.islands < 1 || options.migration.interval < 1 || options.migration.migrants < 0) {
+        std::cerr << "Valeur invalide (iles, intervalle et migrants)\n";
+        return false;
+    }
+    return true;
+}
+
+static void writeStatsRow(std::ostream& out, const GenerationStats& s, long long tick) {
+    out << s.generation << ',' << tick << ',' << s.preys << ',' << s.predators << ',' << s.food << ','
+        << s.preyAvgFitness << ',' << s.preyBestFitness << ','
+        << s.predatorAvgFitness << ',' << s.predatorBestFitness << '\n';
+}
+
+static void writeEntities(std::ostream& out, const Simulation& sim, const std::string& prefix) {
+    auto writeEntity = [&out, &prefix](const char* species, const Entity& e) {
+        out << prefix << species << ',' << e.pos().x << ',' << e.pos().y << ','
+            << e.vel().x << ',' << e.vel().y << ',' << e.energy() << ','
+            << e.fitness << ',' << e.age() << ',' << e.generation << '\n';
+    };
+    for (const auto& prey : sim.getPreys()) writeEntity("prey", *prey);
+    for (const auto& pred : sim.getPredators()) writeEntity("predator", *pred);
+}
+
+static bool writeFinalState(const std::string& path, const Simulation& sim) {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    out << "species,x,y,vx,vy,energy,fitness,age,generation\n";
+    writeEntities(out, sim, "");
+    return true;
+}
+
+// ============ MODÈLE EN ÎLES ============
+// Île i: graine seed + i (0 reste aléatoire), mêmes paramètres pour toutes
+static int runIslands(const HeadlessOptions& options) {
+    std::vector<WorldSpec> specs(options.islands);
+    for (int i = 0; i < options.islands; ++i) {
+        WorldSpec& spec = specs[i];
+        spec.config = options.config;
+        if (options.config.seed != 0) spec.config.seed = options.config.seed + i;
+        if (options.mutationRate >= 0) spec.mutationRate = options.mutationRate;
+        if (options.generationTime > 0) spec.generationTime = options.generationTime;
+        spec.ticks = options.ticks;
+        spec.dt = options.dt;
+    }
+
+    IslandModel model(specs, options.migration);
+    ResultsSink sink;
+
+    // Suivi à la fin des époques (les îles ne sont lisibles qu'entre deux):
+    // une ligne dès que l'île la plus lente a passé un multiple de --progress
+    const auto start = std::chrono::steady_clock::now();
+    long long nextReport = options.progressEvery;
+    bool running = true;
+    while (running) {
+        running = model.runEpoch(sink);
+
+        long long slowest = options.ticks;
+        int generation = INT_MAX;
+        size_t preys = 0, predators = 0;
+        for (size_t i = 0; i < model.size(); ++i) {
+            slowest = std::min(slowest, model.ticks(i));
+            generation = std::min(generation, model.island(i).getGeneration());
+            preys += model.island(i).getPreys().size();
+            predators += model.island(i).getPredators().size();
+        }
+        if (options.progressEvery > 0 && slowest >= nextReport) {
+            std::cerr << "tick " << slowest << "/" << options.ticks
+                      << "  generation " << generation
+                      << "  proies " << preys
+                      << "  predateurs " << predators
+                      << "  (" << model.size() << " iles)\n";
+            nextReport = (slowest / options.progressEvery + 1) * options.progressEvery;
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!options.statsPath.empty()) {
+        std::ofstream stats(options.statsPath);
+        if (!stats) {
+            std::cerr << "Impossible d'ecrire " << options.statsPath << "\n";
+            return 1;
+        }
+        sink.writeCsv(stats, model.worlds());
+    }
+
+    if (!options.finalPath.empty()) {
+        std::ofstream out(options.finalPath);
+        if (!out) {
+            std::cerr << "Impossible d'ecrire " << options.finalPath << "\n";
+            return 1;
+        }
+        out << "island,species,x,y,vx,vy,energy,fitness,age,generation\n";
+        for (size_t i = 0; i < model.size(); ++i)
+            writeEntities(out, model.island(i), std::to_string(i) + ",");
+    }
+
+    const double ticks = (double)options.ticks * model.size();
+    std::cout << model.size() << " iles x " << options.ticks << " ticks en " << seconds << " s"
+              << ", " << (seconds > 0 ? ticks / seconds : 0) << " ticks/s"
+              << ", x" << (seconds > 0 ? ticks * options.dt / seconds : 0) << " temps reel cumule\n";
+    return 0;
+}
+
+// ============ MAIN ============
+int main(int argc, char** argv) {
+    HeadlessOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (options.islands > 1)
+        return runIslands(options);
+
+    GUI::GUIControls gui;
+    if (options.mutationRate >= 0) gui.mutationRate = options.mutationRate;
+    if (options.generationTime > 0) gui.generationTime = options.generationTime;
+
+    std::ofstream stats;
+    if (!options.statsPath.empty()) {
+        stats.open(options.statsPath);
+        if (!stats) {
+            std::cerr << "Impossible d'ecrire " << options.statsPath << "\n";
+            return 1;
+        }
+        stats << "generation,tick,preys,predators,food,prey_avg_fitness,prey_best_fitness,"
+                 "predator_avg_fitness,predator_best_fitness\n";
+    }
+
+    Simulation sim(gui, options.config);
+
+    const auto start = std::chrono::steady_clock::now();
+    int generation = sim.getGeneration();
+
+    for (long long tick = 1; tick <= options.ticks; ++tick) {
+        sim.update(options.dt);
+
+        // evolve() vient de clore une génération
+        if (sim.getGeneration() != generation) {
+            generation = sim.getGeneration();
+            if (stats.is_open()) writeStatsRow(stats, sim.lastGenerationStats(), tick);
+        }
+
+        if (options.progressEvery > 0 && tick % options.progressEvery == 0) {
+            std::cerr << "tick " << tick << "/" << options.ticks
+                      << "  generation " << generation
+                      << "  proies " << sim.getPreys().size()
+                      << "  predateurs " << sim.getPredators().size() << "\n";
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!options.finalPath.empty() && !writeFinalState(options.finalPath, sim)) {
+        std::cerr << "Impossible d'ecrire " << options.finalPath << "\n";
+        return 1;
+    }
+
+    const double simulated = options.ticks * (double)options.dt;
+    std::cout << options.ticks << " ticks (" << simulated << " s simules) en " << seconds << " s"
+              << ", " << (seconds > 0 ? options.ticks / seconds : 0) << " ticks/s"
+              << ", x" << (seconds > 0 ? simulated / seconds : 0) << " temps reel"
+              << ", generation " << sim.getGeneration() << "\n";
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "islandmodel.h"
+#include "migrationqueue.h"
+#include "gui.h"
+#include <algorithm>
+#include <atomic>
+
+// Migrants en attente par île. Une file contient au plus les envois de deux
+// époques (la précédente, pas encore lue, et la courante): migrants est donc
+// limité à la moitié, et aucun push() n'échoue.
+static constexpr size_t INBOX_CAPACITY = 16;
+
+struct IslandModel::Island {
+    GUI::GUIControls gui;             // Paramètres de l'île, avant sim (référencés)
+    std::unique_ptr<Simulation> sim;
+    long long tick = 0;
+    MigrationQueue<Prey::Brain, INBOX_CAPACITY> inbox;
+    // Migrants arrivés avant le début de l'époque: seuls ceux-là sont lus,
+    // ceux que l'île précédente envoie pendant l'époque attendent la suivante
+    size_t arrived = 0;
+};
+
+IslandModel::IslandModel(std::vector<WorldSpec> specs, const MigrationConfig& migration)
+    : specs(std::move(specs)), migration(migration) {
+    this->migration.interval = std::max(1, this->migration.interval);
+    this->migration.migrants = std::clamp(this->migration.migrants, 0, (int)INBOX_CAPACITY / 2);
+
+    for (const WorldSpec& spec : this->specs) {
+        auto island = std::make_unique<Island>();
+        island->gui.mutationRate = spec.mutationRate;
+        island->gui.generationTime = spec.generationTime;
+        island->sim = std::make_unique<Simulation>(island->gui, spec.config);
+        islands.push_back(std::move(island));
+    }
+}
+
+IslandModel::~IslandModel() = default;
+
+const Simulation& IslandModel::island(size_t index) const {
+    return *islands[index]->sim;
+}
+
+long long IslandModel::ticks(size_t index) const {
+    return islands[index]->tick;
+}
+
+bool IslandModel::advance(size_t index, int untilGeneration, ResultsSink& sink) {
+    const WorldSpec& spec = specs[index];
+    Island& island = *islands[index];
+    Simulation& sim = *island.sim;
+
+    // Migrants de l'époque précédente (sim vient de passer evolve()); ceux
+    // qui ne trouvent pas de place (population trop petite) sont perdus
+    const size_t received = sim.receivePreyMigrants(island.arrived, [&island](Prey::Brain& brain) {
+        return island.inbox.pop(brain);
+    });
+    island.inbox.drop(island.arrived - received);
+
+    int generation = sim.getGeneration();
+    while (island.tick < spec.ticks && generation < untilGeneration) {
+        sim.update(spec.dt);
+        ++island.tick;
+
+        // evolve() vient de clore une génération
+        if (sim.getGeneration() != generation) {
+            generation = sim.getGeneration();
+            sink.record(index, island.tick, sim.lastGenerationStats());
+        }
+    }
+
+    // Fin d'époque: evolve() a rangé les survivants en tête, meilleur d'abord
+    if (generation >= untilGeneration && islands.size() > 1) {
+        Island& next = *islands[(index + 1) % islands.size()];
+        const auto& preys = sim.getPreys();
+        const size_t count = std::min((size_t)migration.migrants, preys.size());
+        for (size_t i = 0; i < count; ++i)
+            next.inbox.push(preys[i]->brain);
+    }
+
+    return island.tick < spec.ticks;
+}
+
+void IslandModel::run(ResultsSink& sink) {
+    while (runEpoch(sink)) {}
+}
+
+// Une époque = une boucle parallèle (un bloc par île)
+bool IslandModel::runEpoch(ResultsSink& sink) {
+    untilGeneration += migration.interval;
+    for (auto& island : islands)
+        island->arrived = island->inbox.size();
+
+    std::atomic<size_t> running{0};
+    ScratchArena arena(4096);
+    TaskGraph epoch(arena);
+    const int until = untilGeneration;
+    epoch.parallelFor(islands.size(), 1, [this, &sink, &running, until](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            if (advance(i, until, sink))
+                running.fetch_add(1);
+    });
+    TaskScheduler::shared().run(epoch);
+    return running.load() > 0;
+}
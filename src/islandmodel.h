@@ -0,0 +1,67 @@
+#ifndef ISLANDMODEL_H
+#define ISLANDMODEL_H
+#include "worldrunner.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+// Fréquence et volume des échanges entre îles
+struct MigrationConfig {
+    int interval = 5;   // Générations entre deux migrations
+    int migrants = 2;   // Meilleures proies envoyées à l'île suivante
+};
+
+// ============================================================================
+// ISLAND MODEL - Algorithme génétique en îles
+// ============================================================================
+// Plusieurs sous-populations (une Simulation chacune, voir WorldSpec)
+// évoluent en parallèle. Toutes les interval générations, chaque île copie
+// les cerveaux de ses meilleures proies dans la MigrationQueue de l'île
+// suivante (anneau 0 -> 1 -> ... -> n-1 -> 0); les migrants remplacent les
+// enfants les plus récents de l'île d'arrivée. Chaque île garde ainsi sa
+// propre lignée tout en recevant de temps en temps du matériel génétique
+// neuf, au lieu de tout faire converger vers les 8 mêmes survivants.
+//
+// Les îles avancent par époques d'interval générations: une boucle parallèle
+// du TaskScheduler par époque, chaque île envoie ses migrants en fin
+// d'époque et lit sa file au début de la suivante. Les arrivées ne dépendent
+// donc pas de l'ordonnancement: à graines fixes, un run est reproductible
+// quel que soit le nombre de threads, et la migration a lieu même avec moins
+// de coeurs que d'îles.
+// ============================================================================
+class IslandModel {
+public:
+    IslandModel(std::vector<WorldSpec> specs, const MigrationConfig& migration);
+    ~IslandModel();
+
+    IslandModel(const IslandModel&) = delete;
+    IslandModel& operator=(const IslandModel&) = delete;
+
+    const std::vector<WorldSpec>& worlds() const { return specs; }
+    size_t size() const { return islands.size(); }
+    const Simulation& island(size_t index) const;
+    // Ticks déjà joués par l'île index
+    long long ticks(size_t index) const;
+
+    // Chaque île avance de son nombre de ticks (WorldSpec::ticks); les bilans
+    // de génération vont dans sink (world = index de l'île)
+    void run(ResultsSink& sink);
+
+    // Une seule époque de run(); false quand toutes les îles ont épuisé
+    // leurs ticks. Entre deux appels les îles sont au repos: l'appelant peut
+    // les lire (suivi de l'avancement).
+    bool runEpoch(ResultsSink& sink);
+
+private:
+    struct Island;
+
+    std::vector<WorldSpec> specs;
+    MigrationConfig migration;
+    std::vector<std::unique_ptr<Island>> islands;
+    int untilGeneration = 1;   // Fin de l'époque courante
+
+    // Une époque d'une île; retourne false quand elle a épuisé ses ticks
+    bool advance(size_t index, int untilGeneration, ResultsSink& sink);
+};
+
+#endif // ISLANDMODEL_H
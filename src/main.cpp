@@ -2,12 +2,66 @@
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <iostream>
+#include <string>
 #include "gui.h"
-#include "simulation.h"
+#include "simulationthread.h"
+#include "worldrenderer.h"
+#include "camera.h"
+#include "commandline.h"
 
 
+// ============ OPTIONS ============
+// Taille du monde, indépendante de la fenêtre (la caméra permet de s'y
+// déplacer)
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --world-width W       largeur du monde (defaut 800)\n"
+              << "  --world-height H      hauteur du monde (defaut 800)\n";
+}
+
+// Retourne false (après un message) si la ligne de commande est invalide
+static bool parseOptions(int argc, char** argv, SimulationConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Option sans valeur: " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+
+        bool ok = true;
+        if (arg == "--world-width") ok = CommandLine::parse(value, config.world.width);
+        else if (arg == "--world-height") ok = CommandLine::parse(value, config.world.height);
+        else {
+            std::cerr << "Option inconnue: " << arg << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Valeur invalide pour " << arg << ": " << value << "\n";
+            return false;
+        }
+    }
+
+    if (!config.world.valid()) {
+        std::cerr << "Valeur invalide (le monde doit mesurer au moins " << WorldConfig::MIN_SIZE << " de cote)\n";
+        return false;
+    }
+    return true;
+}
+
 // ============ MAIN ============
-int main() {
+// Le thread principal ne fait que la fenêtre: événements et dessin du
+// dernier WorldSnapshot. La simulation avance sur son propre thread.
+int main(int argc, char** argv) {
+    SimulationConfig config;
+    if (!parseOptions(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
     GUI::GUIControls gui;
     sf::RenderWindow window(sf::VideoMode({GUI::res_width, GUI::res_height}), "Simulation IA Ecosystem - Proies vs Predateurs");
     window.setFramerateLimit(60);
@@ -17,8 +71,9 @@ int main() {
         std::cerr << "Font not found. Using default rendering.\n";
     }
 
-    Simulation sim(gui);
-    sf::Clock clock;
+    SimulationThread simulation(config);
+    WorldRenderer renderer;
+    Camera camera(config.world.size(), {GUI::res_width, GUI::res_height});
 
     while (window.isOpen()) {
         while (const std::optional event = window.pollEvent()) {
@@ -26,17 +81,19 @@ int main() {
                 window.close();
             }
             else if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
-                sim.handleKeyPress(keyPressed->code);
+                gui.handleInput(keyPressed->code);
             }
+            camera.handleEvent(*event);
         }
+        simulation.setControls(gui);
 
-        float dt = clock.restart().asSeconds();
-        gui.fastForwardRate = 1.0f,
-        //dt *= gui.fastForwardRate;
-        sim.update(dt);
+        const WorldSnapshot& world = simulation.latest();
+        gui.achievedSpeed = world.achievedSpeed;
+        for (const auto& [name, value] : world.debugValues)
+            gui.debugMonitor.setValue(name, value);
 
-        window.clear(sf::Color(20, 20, 30));
-        sim.draw(window, font);
+        window.clear(WorldRenderer::BACKGROUND);
+        renderer.draw(window, font, world, gui, camera);
         window.display();
     }
 
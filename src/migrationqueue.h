@@ -0,0 +1,68 @@
+#ifndef MIGRATIONQUEUE_H
+#define MIGRATIONQUEUE_H
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// ============================================================================
+// MIGRATION QUEUE - File sans verrou entre deux îles
+// ============================================================================
+// Un seul producteur (l'île qui envoie ses meilleurs génomes) et un seul
+// consommateur (l'île voisine): deux compteurs atomiques suffisent, ni
+// mutex ni allocation. Le producteur n'écrit que tail, le consommateur que
+// head; chacun sur sa propre ligne de cache.
+//
+// Les cases sont de la mémoire brute copiée par memcpy: T doit être
+// trivialement copiable (un NeuralNetwork l'est), et aucun T n'est construit
+// d'avance (le constructeur d'un réseau tire des poids aléatoires).
+// File pleine: push() rend false et le migrant est simplement perdu.
+// ============================================================================
+template <typename T, size_t Capacity>
+class MigrationQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity doit être une puissance de 2");
+    static_assert(std::is_trivially_copyable<T>::value, "les migrants sont copiés par memcpy");
+
+public:
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Migrants en attente (exact si aucun push() n'est en cours)
+    size_t size() const {
+        return tailIndex.load(std::memory_order_acquire) - headIndex.load(std::memory_order_acquire);
+    }
+
+    // Côté producteur
+    bool push(const T& value) {
+        const size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) == Capacity)
+            return false;
+        std::memcpy(slots[tail & (Capacity - 1)], &value, sizeof(T));
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Côté consommateur: copie le plus ancien migrant dans out
+    bool pop(T& out) {
+        const size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire))
+            return false;
+        std::memcpy(&out, slots[head & (Capacity - 1)], sizeof(T));
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Côté consommateur: abandonne les count plus anciens migrants
+    void drop(size_t count) {
+        const size_t head = headIndex.load(std::memory_order_relaxed);
+        count = std::min(count, tailIndex.load(std::memory_order_acquire) - head);
+        headIndex.store(head + count, std::memory_order_release);
+    }
+
+private:
+    alignas(64) std::atomic<size_t> headIndex{0};
+    alignas(64) std::atomic<size_t> tailIndex{0};
+    alignas(64) unsigned char slots[Capacity][sizeof(T)];
+};
+
+#endif // MIGRATIONQUEUE_H
@@ -0,0 +1,96 @@
+#include "neuralkernels.h"
+#include <cstdlib>
+#include <cstring>
+
+#if defined(BIOSIM_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Les noyaux sont des templates (un jeu par topologie, voir neuralkernels.h):
+// il ne reste ici que la détection du CPU et le choix de l'implémentation.
+
+#ifdef BIOSIM_X86
+
+// ============================================================================
+// DÉTECTION DU CPU
+// ============================================================================
+#if defined(_MSC_VER) && !defined(__clang__)
+static bool cpuHasSSE41() {
+    int regs[4];
+    __cpuid(regs, 1);
+    return (regs[2] & (1 << 19)) != 0;
+}
+
+static bool cpuHasAVX2() {
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) return false;
+    __cpuid(regs, 1);
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool fma = (regs[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+}
+#else
+static bool cpuHasSSE41() {
+    return __builtin_cpu_supports("sse4.1");
+}
+
+static bool cpuHasAVX2() {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+#endif
+
+#endif // BIOSIM_X86
+
+// ============================================================================
+// SÉLECTION
+// ============================================================================
+bool NeuralKernels::supported(Isa isa) {
+#ifdef BIOSIM_X86
+    static const bool sse4 = cpuHasSSE41();
+    static const bool avx2 = cpuHasAVX2();
+    switch (isa) {
+    case Isa::SSE4: return sse4;
+    case Isa::AVX2: return avx2;
+    default:        return true;
+    }
+#else
+    return isa == Isa::Scalar;
+#endif
+}
+
+namespace {
+    struct Selection {
+        NeuralKernels::Isa isa;
+        const char* name;
+    };
+
+    Selection select() {
+        using NeuralKernels::Isa;
+        using NeuralKernels::supported;
+        const char* forced = std::getenv("BIOSIM_SIMD");
+        if (forced) {
+            if (std::strcmp(forced, "scalar") == 0) return {Isa::Scalar, "scalar"};
+            if (std::strcmp(forced, "sse4") == 0 && supported(Isa::SSE4)) return {Isa::SSE4, "sse4"};
+            if (std::strcmp(forced, "avx2") == 0 && supported(Isa::AVX2)) return {Isa::AVX2, "avx2"};
+        }
+        if (supported(Isa::AVX2)) return {Isa::AVX2, "avx2"};
+        if (supported(Isa::SSE4)) return {Isa::SSE4, "sse4"};
+        return {Isa::Scalar, "scalar"};
+    }
+
+    const Selection& selection() {
+        static const Selection chosen = select();
+        return chosen;
+    }
+}
+
+NeuralKernels::Isa NeuralKernels::active() {
+    return selection().isa;
+}
+
+const char* NeuralKernels::name() {
+    return selection().name;
+}
@@ -1,39 +1,140 @@
 #ifndef NEURALNETWORK_H
 #define NEURALNETWORK_H
-#include <SFML/Graphics.hpp>
-#include <SFML/Window.hpp>
-#include <SFML/System.hpp>
-#include <vector>
-#include <random>
-#include <memory>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include "neuralkernels.h"
+#include "randomstream.h"
 
+// ============================================================================
+// NEURAL NETWORK - Perceptron In -> Hidden -> Out (sigmoïdes)
+// ============================================================================
+// Les dimensions sont des paramètres template: Prey et Predator choisissent
+// leur topologie à la compilation (Prey::Brain, Predator::Brain). Tous les
+// paramètres sont dans UN seul tableau inline aligné sur 64 octets:
+//
+//   [ w1: Hidden lignes de InStride ][ b1: HiddenStride ]
+//   [ w2: Out lignes de HiddenStride ][ b2: OutStride ]
+//
+// w1 est rangé "par neurone caché" (ligne i = poids des entrées vers le
+// neurone i): le produit scalaire lit donc une ligne contiguë. Les lignes
+// sont complétées par des zéros jusqu'à un multiple de 8 floats (un registre
+// AVX). Aucune allocation: forward() travaille sur la pile, clone() est une
+// copie par valeur et mutate() modifie le tableau sur place.
+//
+// Les tirages (poids initiaux, mutations) se font dans le RandomStream passé
+// en argument: Simulation ouvre un flux par naissance et par mutation (clé:
+// graine, tick, identifiant de l'entité). Il n'y a pas de flux implicite:
+// un réseau ne peut pas être tiré hors d'un flux reproductible.
+// ============================================================================
+constexpr int paddedSize(int n) { return (n + 7) & ~7; }
+
+template <int In, int Hidden, int Out>
 class NeuralNetwork
 {
-private:
-    std::vector<std::vector<float>> w1, w2;
-    std::vector<float> b1, b2;
-
-    // Cache pour la backpropagation
-    std::vector<float> lastInput;
-    std::vector<float> lastHidden;
-    std::array<float, 2> lastOutput;
-
-    static std::mt19937& getRNG();
-    static inline float sigmoid(float x);
-    static inline float sigmoidDerivative(float x);
-    static float randomWeight();
 public:
-    NeuralNetwork(int input, int hidden, int output);
-    std::array<float, 2> forward(const std::array<float, 8>& input);
+    static constexpr int InputSize = In;
+    static constexpr int HiddenSize = Hidden;
+    static constexpr int OutputSize = Out;
+    static constexpr int InStride = paddedSize(In);
+    static constexpr int HiddenStride = paddedSize(Hidden);
+    static constexpr int OutStride = paddedSize(Out);
+
+    using Input = std::array<float, In>;
+    using Output = std::array<float, Out>;
+
+    // Poids et biais uniformes dans [-1, 1], tirés dans rng
+    explicit NeuralNetwork(RandomStream& rng);
+
+    Output forward(const Input& input) const;
 
-    // Backpropagation: calcule les gradients et met à jour les poids
-    // target: la sortie désirée
-    // learningRate: taux d'apprentissage (ex: 0.01)
-    void backward(const std::array<float, 2>& target, float learningRate);
+    // Les deux couches séparément, sur des vecteurs bruts (BrainBatch
+    // enchaîne chaque couche sur toute la population). Les vecteurs ont la
+    // taille paddée (multiple de 8) et leur padding est à zéro. Les noyaux
+    // sont instanciés pour ces dimensions exactes.
+    void hiddenLayer(const float* input, float* hidden) const {
+        NeuralKernels::dense<Hidden, InStride>()(w1(), b1(), input, hidden);
+    }
+    void outputLayer(const float* hidden, float* output) const {
+        NeuralKernels::dense<Out, HiddenStride>()(w2(), b2(), hidden, output);
+    }
+
+    // Chaque poids mute avec la probabilité rate (tirages dans rng)
+    void mutate(float rate, RandomStream& rng);
+    NeuralNetwork clone() const { return *this; }
+
+    // Accès au buffer de paramètres (taille paramCount())
+    const float* data() const { return params.data(); }
+    static constexpr size_t paramCount() { return ParamCount; }
+
+private:
+    // Début de chaque bloc dans params
+    static constexpr int W1 = 0;
+    static constexpr int B1 = W1 + Hidden * InStride;
+    static constexpr int W2 = B1 + HiddenStride;
+    static constexpr int B2 = W2 + Out * HiddenStride;
+    static constexpr int ParamCount = B2 + OutStride;
 
-    void mutate(float rate);
-    std::unique_ptr<NeuralNetwork> clone() const;
+    alignas(64) std::array<float, ParamCount> params{};
+
+    float* w1() { return params.data() + W1; }
+    float* b1() { return params.data() + B1; }
+    float* w2() { return params.data() + W2; }
+    float* b2() { return params.data() + B2; }
+    const float* w1() const { return params.data() + W1; }
+    const float* b1() const { return params.data() + B1; }
+    const float* w2() const { return params.data() + W2; }
+    const float* b2() const { return params.data() + B2; }
 };
 
+template <int In, int Hidden, int Out>
+NeuralNetwork<In, Hidden, Out>::NeuralNetwork(RandomStream& rng) {
+    // Seules les vraies cases reçoivent un poids, le padding reste à zéro
+    for (int i = 0; i < Hidden; ++i)
+        for (int j = 0; j < In; ++j)
+            w1()[i * InStride + j] = rng.uniform(-1.0f, 1.0f);
+
+    for (int i = 0; i < Out; ++i)
+        for (int j = 0; j < Hidden; ++j)
+            w2()[i * HiddenStride + j] = rng.uniform(-1.0f, 1.0f);
+
+    for (int i = 0; i < Hidden; ++i)
+        b1()[i] = rng.uniform(-1.0f, 1.0f);
+
+    for (int i = 0; i < Out; ++i)
+        b2()[i] = rng.uniform(-1.0f, 1.0f);
+}
+
+template <int In, int Hidden, int Out>
+typename NeuralNetwork<In, Hidden, Out>::Output
+NeuralNetwork<In, Hidden, Out>::forward(const Input& input) const {
+    // Les noyaux lisent les vecteurs avec leur padding: copies paddées sur la pile
+    alignas(64) std::array<float, InStride> x{};
+    alignas(64) std::array<float, HiddenStride> hidden{};
+    Output output;
+    for (int j = 0; j < In; ++j)
+        x[j] = input[j];
+    hiddenLayer(x.data(), hidden.data());
+    outputLayer(hidden.data(), output.data());
+    return output;
+}
+
+// Une passe linéaire sur les lignes de poids (les biais ne mutent pas)
+template <int In, int Hidden, int Out>
+void NeuralNetwork<In, Hidden, Out>::mutate(float rate, RandomStream& rng) {
+    for (int i = 0; i < Hidden; ++i) {
+        float* row = w1() + i * InStride;
+        for (int j = 0; j < In; ++j)
+            if (rng.uniform() < rate)
+                row[j] += rng.uniform(-1.0f, 1.0f) * 0.5f;
+    }
+
+    for (int i = 0; i < Out; ++i) {
+        float* row = w2() + i * HiddenStride;
+        for (int j = 0; j < Hidden; ++j)
+            if (rng.uniform() < rate)
+                row[j] += rng.uniform(-1.0f, 1.0f) * 0.5f;
+    }
+}
+
 #endif // NEURALNETWORK_H
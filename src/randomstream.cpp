@@ -0,0 +1,30 @@
+#include "randomstream.h"
+
+// Constantes de Philox4x32 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+static constexpr uint32_t PHILOX_M0 = 0xD2511F53u;
+static constexpr uint32_t PHILOX_M1 = 0xCD9E8D57u;
+static constexpr uint32_t PHILOX_W0 = 0x9E3779B9u;
+static constexpr uint32_t PHILOX_W1 = 0xBB67AE85u;
+
+RandomStream::RandomStream(uint32_t seed, RandomPurpose purpose, uint64_t tick, uint32_t id)
+    : key{seed, (uint32_t)purpose},
+      counter{(uint32_t)tick, (uint32_t)(tick >> 32), id, 0},
+      block{} {}
+
+std::array<uint32_t, 4> RandomStream::philox(std::array<uint32_t, 4> c, std::array<uint32_t, 2> k) {
+    for (int round = 0; round < 10; ++round) {
+        const uint64_t p0 = (uint64_t)PHILOX_M0 * c[0];
+        const uint64_t p1 = (uint64_t)PHILOX_M1 * c[2];
+        c = {(uint32_t)(p1 >> 32) ^ c[1] ^ k[0], (uint32_t)p1,
+             (uint32_t)(p0 >> 32) ^ c[3] ^ k[1], (uint32_t)p0};
+        k[0] += PHILOX_W0;
+        k[1] += PHILOX_W1;
+    }
+    return c;
+}
+
+void RandomStream::refill() {
+    block = philox(counter, key);
+    ++counter[3];
+    used = 0;
+}
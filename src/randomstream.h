@@ -0,0 +1,66 @@
+#ifndef RANDOMSTREAM_H
+#define RANDOMSTREAM_H
+#include <array>
+#include <cstdint>
+
+// Usage d'un flux: deux usages différents ne tirent jamais les mêmes nombres
+enum class RandomPurpose : uint32_t {
+    Terrain,    // Lacs, rivières, prairies, déserts
+    Food,       // Apparition de la nourriture
+    Spawn,      // Naissance d'une entité: position et poids initiaux
+    Mutation    // Mutation du cerveau d'un enfant
+};
+
+// ============================================================================
+// RANDOM STREAM - Générateur à compteur (Philox4x32-10)
+// ============================================================================
+// Pas d'état caché: le n-ième nombre d'un flux est une fonction pure de
+// (graine du monde, usage, tick, identifiant, n). Chaque naissance, chaque
+// mutation et chaque apparition de nourriture ouvre son propre flux sur la
+// pile; rien n'est partagé entre threads, et le résultat ne dépend ni de
+// l'ordre d'exécution ni de ce qui a été tiré ailleurs.
+//
+// Philox: la clé est (graine, usage), le compteur 128 bits (tick, id, n/4).
+// Chaque bloc chiffré donne 4 nombres de 32 bits. Les conversions vers
+// float/int sont faites ici (pas de std::uniform_*_distribution, dont
+// l'algorithme dépend de la bibliothèque standard): un même seed donne le
+// même monde quel que soit le compilateur.
+// ============================================================================
+class RandomStream {
+public:
+    RandomStream(uint32_t seed, RandomPurpose purpose, uint64_t tick, uint32_t id);
+
+    uint32_t next() {
+        if (used == 4) refill();
+        return block[used++];
+    }
+
+    // Uniforme dans [0, 1)
+    float uniform() { return (next() >> 8) * (1.0f / 16777216.0f); }
+    // Uniforme entre min et max
+    float uniform(float min, float max) { return min + (max - min) * uniform(); }
+    // Entier uniforme dans [min, max]
+    int uniformInt(int min, int max) {
+        const uint64_t range = (uint64_t)((int64_t)max - min) + 1;
+        return (int)(min + (int64_t)((next() * range) >> 32));
+    }
+
+    // Compatible UniformRandomBitGenerator (std::shuffle...)
+    using result_type = uint32_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFFu; }
+    result_type operator()() { return next(); }
+
+    // Philox4x32-10 brut (exposé pour les vérifications)
+    static std::array<uint32_t, 4> philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key);
+
+private:
+    std::array<uint32_t, 2> key;
+    std::array<uint32_t, 4> counter;   // tick (bas, haut), id, index de bloc
+    std::array<uint32_t, 4> block;
+    int used = 4;
+
+    void refill();
+};
+
+#endif // RANDOMSTREAM_H
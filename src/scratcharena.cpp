@@ -0,0 +1,52 @@
+#include "scratcharena.h"
+#include <new>
+
+static char* allocateBlock(std::size_t size) {
+    return static_cast<char*>(::operator new(size, std::align_val_t(ScratchArena::Align)));
+}
+
+static void freeBlock(void* block) {
+    ::operator delete(block, std::align_val_t(ScratchArena::Align));
+}
+
+ScratchArena::ScratchArena(std::size_t initialSize)
+    : block(allocateBlock(initialSize)), size(initialSize), offset(0), overflowBytes(0) {}
+
+ScratchArena::~ScratchArena() {
+    for (void* p : overflow)
+        freeBlock(p);
+    freeBlock(block);
+}
+
+void* ScratchArena::allocate(std::size_t bytes, std::size_t align) {
+    const std::size_t start = (offset + align - 1) & ~(align - 1);
+    if (start + bytes <= size) {
+        offset = start + bytes;
+        return block + start;
+    }
+
+    // Bloc principal plein: débordement sur le tas jusqu'au prochain reset()
+    void* p = allocateBlock(std::max<std::size_t>(bytes, 1));
+    overflow.push_back(p);
+    overflowBytes += bytes + Align;
+    return p;
+}
+
+void ScratchArena::reset() {
+    if (!overflow.empty()) {
+        // Le pic du tick précédent doit tenir dans le bloc principal
+        const std::size_t peak = offset + overflowBytes;
+        for (void* p : overflow)
+            freeBlock(p);
+        overflow.clear();
+
+        std::size_t newSize = size;
+        while (newSize < peak)
+            newSize *= 2;
+        freeBlock(block);
+        block = allocateBlock(newSize);
+        size = newSize;
+    }
+    offset = 0;
+    overflowBytes = 0;
+}
@@ -0,0 +1,98 @@
+#ifndef SCRATCHARENA_H
+#define SCRATCHARENA_H
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+// ============================================================================
+// SCRATCH ARENA - Mémoire temporaire d'un monde, remise à zéro à chaque tick
+// ============================================================================
+// Allocation "bump": on avance un curseur dans un bloc aligné sur 64 octets,
+// rien n'est libéré individuellement. Chaque Simulation possède son arène
+// (membre scratch), pas chaque thread: les tâches du graphe d'un tick, quel
+// que soit le worker qui les exécute, puisent dans l'arène de leur monde, et
+// des mondes parallèles (WorldRunner, IslandModel) ne se partagent rien.
+// Simulation::update appelle reset() au début de chaque tick: tout ce qui a
+// été pris dans l'arène pendant le tick précédent est alors invalide (à
+// réserver aux temporaires du tick). Une arène n'est pas thread-safe: dans
+// un tick, seule une phase à la fois y alloue.
+//
+// Si le bloc est plein, un bloc de débordement est alloué sur le tas. Au
+// reset() suivant, les débordements sont rendus et le bloc principal est
+// agrandi à la taille du pic: après quelques ticks de chauffe, un tick
+// normal ne fait plus aucune allocation sur le tas.
+//
+// Les destructeurs ne sont jamais appelés: seuls les types trivialement
+// destructibles passent par allocate<T>().
+// ============================================================================
+class ScratchArena {
+public:
+    static constexpr std::size_t Align = 64;
+
+    explicit ScratchArena(std::size_t initialSize = 64 * 1024);
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    // align doit être une puissance de 2 <= Align
+    void* allocate(std::size_t bytes, std::size_t align = Align);
+
+    // count éléments NON initialisés, alignés sur une ligne de cache
+    template <typename T>
+    T* allocate(std::size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "ScratchArena n'appelle pas les destructeurs");
+        return static_cast<T*>(allocate(count * sizeof(T), Align));
+    }
+
+    // Invalide tout ce qui a été alloué depuis le dernier reset()
+    void reset();
+
+    std::size_t used() const { return offset + overflowBytes; }
+    std::size_t capacity() const { return size; }
+
+private:
+    char* block;
+    std::size_t size;
+    std::size_t offset;
+
+    std::vector<void*> overflow;   // Blocs de débordement du tick en cours
+    std::size_t overflowBytes;
+};
+
+// ============================================================================
+// SCRATCH ALLOCATOR - Allocateur std:: qui puise dans une ScratchArena
+// ============================================================================
+// Pour les conteneurs temporaires d'un tick dont la taille n'est pas connue
+// d'avance (ScratchVector<T>). deallocate() ne fait rien: la mémoire est
+// récupérée en bloc au reset() de l'arène. Le conteneur ne doit donc pas
+// survivre au tick.
+// ============================================================================
+template <typename T>
+struct ScratchAllocator {
+    using value_type = T;
+
+    ScratchArena* arena;
+
+    explicit ScratchAllocator(ScratchArena& a) noexcept : arena(&a) {}
+    template <typename U>
+    ScratchAllocator(const ScratchAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), std::min(alignof(T), ScratchArena::Align)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ScratchAllocator<U>& other) const noexcept { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ScratchAllocator<U>& other) const noexcept { return arena != other.arena; }
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
+#endif // SCRATCHARENA_H
@@ -1,4 +1,5 @@
 #include "simulation.h"
+#include "allocationcounter.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
@@ -15,20 +16,33 @@
 
 
 //PRIVATE DEF
-std::mt19937& Simulation::getRNG() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    return gen;
+RandomStream Simulation::stream(RandomPurpose purpose, uint32_t id) const {
+    return RandomStream(seed, purpose, tickCount, id);
 }
 
-float Simulation::randFloat(float min, float max) {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(getRNG());
-}
-
-int Simulation::randInt(int min, int max) {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(getRNG());
+// ============================================================================
+// NAISSANCE D'UNE ENTITÉ
+// ============================================================================
+// Chaque entité reçoit un identifiant unique; sa position (dans le
+// rectangle [min, max]) et ses poids initiaux sont tirés dans son propre
+// flux (Spawn, tick, id): une naissance ne dépend d'aucune autre. Sans args,
+// ce flux est passé au constructeur de T pour le cerveau; un enfant reçoit
+// le cerveau de son parent par args et aucun poids n'est alors tiré.
+// ============================================================================
+template <typename T, typename... Args>
+std::unique_ptr<T> Simulation::spawnEntity(EntityStore& store, sf::Vector2f min, sf::Vector2f max, Args&&... args) {
+    const uint32_t id = nextEntityId++;
+    RandomStream rng = stream(RandomPurpose::Spawn, id);
+    const float x = rng.uniform(min.x, max.x);
+    const float y = rng.uniform(min.y, max.y);
+
+    std::unique_ptr<T> entity;
+    if constexpr (sizeof...(Args) == 0)
+        entity = std::make_unique<T>(store, x, y, rng);
+    else
+        entity = std::make_unique<T>(store, x, y, std::forward<Args>(args)...);
+    entity->id = id;
+    return entity;
 }
 
 // ============================================================================
@@ -39,24 +53,27 @@ int Simulation::randInt(int min, int max) {
 // vitesse, de cycling et de comportement des entités.
 // ============================================================================
 void Simulation::generateTerrain() {
-    terrain.clear();
+    // Nouveau tableau, publié à la fin: un snapshot qui tient encore
+    // l'ancien terrain le garde intact
+    auto tiles = std::make_shared<std::vector<TerrainTile>>();
+    RandomStream rng = stream(RandomPurpose::Terrain);
 
     // TERRAIN DISABLED - Tout le code de génération de terrain est commenté
     // pour alléger le code et faciliter le debugging
 
 
     // Générer des lacs (eau en forme organique)
-    int numLakes = randInt(2, 4);
+    int numLakes = rng.uniformInt(2, 4);
     for (int i = 0; i < numLakes; ++i) {
-        float centerX = randFloat(100, GUI::res_width - 100);
-        float centerY = randFloat(100, GUI::res_height - 100);
-        float baseRadius = randFloat(50, 80);
+        float centerX = rng.uniform(100, world.width - 100);
+        float centerY = rng.uniform(100, world.height - 100);
+        float baseRadius = rng.uniform(50, 80);
 
         std::vector<sf::Vector2f> lakePoints;
-        int numPoints = randInt(8, 12);
+        int numPoints = rng.uniformInt(8, 12);
         for (int j = 0; j < numPoints; ++j) {
             float angle = (j * 2.0f * 3.14159f) / numPoints;
-            float radius = baseRadius + randFloat(-20, 20);
+            float radius = baseRadius + rng.uniform(-20, 20);
             lakePoints.push_back({
                 centerX + std::cos(angle) * radius,
                 centerY + std::sin(angle) * radius
@@ -65,27 +82,27 @@ void Simulation::generateTerrain() {
 
         TerrainTile lake(TerrainType::WATER);
         lake.setAsPolygon(lakePoints, sf::Color(50, 100, 200, 120));
-        terrain.push_back(lake);
+        tiles->push_back(lake);
     }
 
     // Générer des rivières
-    int numRivers = randInt(1, 2);
+    int numRivers = rng.uniformInt(1, 2);
     for (int i = 0; i < numRivers; ++i) {
-        float y = randFloat(100, GUI::res_height - 100);
-        float width = randFloat(30, 50);
+        float y = rng.uniform(100, world.height - 100);
+        float width = rng.uniform(30, 50);
 
         std::vector<sf::Vector2f> riverPoints;
         float segments = 10;
         for (int j = 0; j <= segments; ++j) {
             float t = j / segments;
-            float x = (i == 0) ? (t * GUI::res_width) : (GUI::res_width - t * GUI::res_width);
+            float x = (i == 0) ? (t * world.width) : (world.width - t * world.width);
             float yOffset = std::sin(t * 6.0f) * 40.0f;
 
             riverPoints.push_back({x, y + yOffset - width/2});
         }
         for (int j = segments; j >= 0; --j) {
             float t = j / segments;
-            float x = (i == 0) ? (t * GUI::res_width) : (GUI::res_width - t * GUI::res_width);
+            float x = (i == 0) ? (t * world.width) : (world.width - t * world.width);
             float yOffset = std::sin(t * 6.0f) * 40.0f;
 
             riverPoints.push_back({x, y + yOffset + width/2});
@@ -93,21 +110,21 @@ void Simulation::generateTerrain() {
 
         TerrainTile river(TerrainType::WATER);
         river.setAsPolygon(riverPoints, sf::Color(50, 100, 200, 120));
-        terrain.push_back(river);
+        tiles->push_back(river);
     }
 
     // Générer des prairies (patches irréguliers)
-    int numGrass = randInt(6, 10);
+    int numGrass = rng.uniformInt(6, 10);
     for (int i = 0; i < numGrass; ++i) {
-        float centerX = randFloat(50, GUI::res_width - 50);
-        float centerY = randFloat(50, GUI::res_height - 50);
-        float baseRadius = randFloat(60, 100);
+        float centerX = rng.uniform(50, world.width - 50);
+        float centerY = rng.uniform(50, world.height - 50);
+        float baseRadius = rng.uniform(60, 100);
 
         std::vector<sf::Vector2f> grassPoints;
-        int numPoints = randInt(6, 10);
+        int numPoints = rng.uniformInt(6, 10);
         for (int j = 0; j < numPoints; ++j) {
             float angle = (j * 2.0f * 3.14159f) / numPoints;
-            float radius = baseRadius + randFloat(-30, 30);
+            float radius = baseRadius + rng.uniform(-30, 30);
             grassPoints.push_back({
                 centerX + std::cos(angle) * radius,
                 centerY + std::sin(angle) * radius
@@ -118,17 +135,17 @@ void Simulation::generateTerrain() {
         grass.setAsPolygon(grassPoints, sf::Color(100, 200, 100, 100));
 
         // Ajouter quelques arbres dans les prairies
-        int numTrees = randInt(2, 5);
+        int numTrees = rng.uniformInt(2, 5);
         for (int t = 0; t < numTrees; ++t) {
-            float treeX = centerX + randFloat(-baseRadius/2, baseRadius/2);
-            float treeY = centerY + randFloat(-baseRadius/2, baseRadius/2);
-            float treeRadius = randFloat(8, 15);
+            float treeX = centerX + rng.uniform(-baseRadius/2, baseRadius/2);
+            float treeY = centerY + rng.uniform(-baseRadius/2, baseRadius/2);
+            float treeRadius = rng.uniform(8, 15);
 
             std::vector<sf::Vector2f> treePoints;
-            int treePointCount = randInt(6, 8);
+            int treePointCount = rng.uniformInt(6, 8);
             for (int p = 0; p < treePointCount; ++p) {
                 float angle = (p * 2.0f * 3.14159f) / treePointCount;
-                float r = treeRadius + randFloat(-3, 3);
+                float r = treeRadius + rng.uniform(-3, 3);
                 treePoints.push_back({
                     treeX + std::cos(angle) * r,
                     treeY + std::sin(angle) * r
@@ -137,21 +154,21 @@ void Simulation::generateTerrain() {
             grass.addRock(treePoints, sf::Color(60, 120, 60));
         }
 
-        terrain.push_back(grass);
+        tiles->push_back(grass);
     }
 
     // Générer des déserts (zones arides)
-    int numDeserts = randInt(3, 5);
+    int numDeserts = rng.uniformInt(3, 5);
     for (int i = 0; i < numDeserts; ++i) {
-        float centerX = randFloat(50, GUI::res_width - 50);
-        float centerY = randFloat(50, GUI::res_height - 50);
-        float baseRadius = randFloat(70, 120);
+        float centerX = rng.uniform(50, world.width - 50);
+        float centerY = rng.uniform(50, world.height - 50);
+        float baseRadius = rng.uniform(70, 120);
 
         std::vector<sf::Vector2f> desertPoints;
-        int numPoints = randInt(5, 8);
+        int numPoints = rng.uniformInt(5, 8);
         for (int j = 0; j < numPoints; ++j) {
             float angle = (j * 2.0f * 3.14159f) / numPoints;
-            float radius = baseRadius + randFloat(-25, 25);
+            float radius = baseRadius + rng.uniform(-25, 25);
             desertPoints.push_back({
                 centerX + std::cos(angle) * radius,
                 centerY + std::sin(angle) * radius
@@ -162,17 +179,17 @@ void Simulation::generateTerrain() {
         desert.setAsPolygon(desertPoints, sf::Color(220, 200, 100, 100));
 
         // Ajouter des rochers anguleux dans le désert
-        int numRocks = randInt(3, 7);
+        int numRocks = rng.uniformInt(3, 7);
         for (int r = 0; r < numRocks; ++r) {
-            float rockX = centerX + randFloat(-baseRadius/2, baseRadius/2);
-            float rockY = centerY + randFloat(-baseRadius/2, baseRadius/2);
-            float rockSize = randFloat(10, 20);
+            float rockX = centerX + rng.uniform(-baseRadius/2, baseRadius/2);
+            float rockY = centerY + rng.uniform(-baseRadius/2, baseRadius/2);
+            float rockSize = rng.uniform(10, 20);
 
             std::vector<sf::Vector2f> rockPoints;
-            int rockPointCount = randInt(5, 7);
+            int rockPointCount = rng.uniformInt(5, 7);
             for (int p = 0; p < rockPointCount; ++p) {
                 float angle = (p * 2.0f * 3.14159f) / rockPointCount;
-                float r = rockSize + randFloat(-5, 5);
+                float r = rockSize + rng.uniform(-5, 5);
                 rockPoints.push_back({
                     rockX + std::cos(angle) * r,
                     rockY + std::sin(angle) * r
@@ -181,9 +198,10 @@ void Simulation::generateTerrain() {
             desert.addRock(rockPoints, sf::Color(100, 90, 80));
         }
 
-        terrain.push_back(desert);
+        tiles->push_back(desert);
     }
 
+    terrain = std::move(tiles);
 }
 
 // ============================================================================
@@ -193,21 +211,24 @@ void Simulation::generateTerrain() {
 // dans toute la carte au lieu de seulement dans les prairies.
 // ============================================================================
 void Simulation::spawnFood() {
+    RandomStream rng = stream(RandomPurpose::Food);
+
     // TERRAIN Enabled - Spawn nourriture aléatoire dans toute la carte
-    int numFood = randInt(3, 8);
+    // (quantité proportionnelle à la surface: même densité qu'en 800x800)
+    int numFood = (int)std::lround(rng.uniformInt(3, 8) * world.areaRatio());
     for (int i = 0; i < numFood; ++i) {
-        float fx = randFloat(50, GUI::res_width - 50);
-        float fy = randFloat(50, GUI::res_height - 50);
-        foods.push_back(std::make_unique<Food>(fx, fy));
+        float fx = rng.uniform(50, world.width - 50);
+        float fy = rng.uniform(50, world.height - 50);
+        foods.add(Food(fx, fy));
     }
 
 
     // Spawn dans les prairies
-    for (const auto& tile : terrain) {
-        if (tile.type == TerrainType::GRASS && randInt(0, 100) < 40) {
+    for (const auto& tile : *terrain) {
+        if (tile.type == TerrainType::GRASS && rng.uniformInt(0, 100) < 40) {
             sf::FloatRect grassBounds = tile.shape.getGlobalBounds();
-            float fx = grassBounds.position.x + randFloat(20, grassBounds.size.x - 20);
-            float fy = grassBounds.position.y + randFloat(20, grassBounds.size.y - 20);
+            float fx = grassBounds.position.x + rng.uniform(20, grassBounds.size.x - 20);
+            float fy = grassBounds.position.y + rng.uniform(20, grassBounds.size.y - 20);
 
             // Éviter de spawner sur les obstacles
             bool onObstacle = false;
@@ -220,7 +241,7 @@ void Simulation::spawnFood() {
             }
 
             if (!onObstacle) {
-                foods.push_back(std::make_unique<Food>(fx, fy));
+                foods.add(Food(fx, fy));
             }
         }
     }
@@ -234,118 +255,312 @@ void Simulation::spawnFood() {
 // GUI unique. Cette référence est stockée dans la liste d'initialisation
 // des membres (gui(guiControls)).
 // ============================================================================
-Simulation::Simulation(GUI::GUIControls& guiControls)
-    : generation(1), timer(0), preyGeneration(1), predGeneration(1),
-      graphUpdateTimer(0), foodSpawnTimer(0), gui(guiControls) {
+Simulation::Simulation(GUI::GUIControls& guiControls, const SimulationConfig& config)
+    : world(config.world),
+      foods(world.width, world.height, Prey::DETECTION_RADIUS / 4),
+      preyGrid(world.width, world.height, Predator::HUNGER_RADIUS / 2),
+      predatorGrid(world.width, world.height, Prey::DETECTION_RADIUS),
+      generation(1), timer(0), preyGeneration(1), predGeneration(1),
+      graphUpdateTimer(0), foodSpawnTimer(0), gui(guiControls),
+      seed(0), tickCount(0), nextEntityId(0) {
+    // Graine fixe: tout ce qui suit (terrain, positions, poids) est reproductible
+    seed = config.seed != 0 ? config.seed : std::random_device{}();
+
     // Générer le terrain aléatoire
     generateTerrain();
 
-    preys.reserve(25);
-    for (int i = 0; i < 25; ++i) {
-        preys.push_back(std::make_unique<Prey>(randFloat(50, GUI::res_width-50), randFloat(50, GUI::res_height-50)));
+    // Nourriture: de quoi tenir FOOD_RESERVE_SPAWNS apparitions au débit
+    // maximal (8 par 800x800 et une par prairie) sans que rien ne soit mangé.
+    // Au-delà, le pool double: rare, mais possible si les proies disparaissent.
+    const size_t foodPerSpawn = (size_t)std::lround(8 * world.areaRatio()) + terrain->size();
+    foods.reserve(foodPerSpawn * FOOD_RESERVE_SPAWNS);
+
+    preys.reserve(config.initialPreys);
+    for (int i = 0; i < config.initialPreys; ++i) {
+        preys.push_back(spawnEntity<Prey>(preyStore, spawnMin(), spawnMax()));
     }
-    predators.reserve(6);
-    for (int i = 0; i < 6; ++i) {
-        predators.push_back(std::make_unique<Predator>(randFloat(50, GUI::res_width-50), randFloat(50, GUI::res_height-50)));
+    predators.reserve(config.initialPredators);
+    for (int i = 0; i < config.initialPredators; ++i) {
+        predators.push_back(spawnEntity<Predator>(predatorStore, spawnMin(), spawnMax()));
     }
 
     spawnFood();
 }
 
+// ============================================================================
+// UPDATE - UN TICK DE SIMULATION
+// ============================================================================
+// Le tick est un graphe de phases exécuté par le TaskScheduler
+// (-> : dépendance, [p] : boucle parallèle par blocs que les workers
+// inoccupés peuvent voler):
+//
+//   spawn nourriture, grille prédateurs -> décision proies [p] -> physique proies [p] -> manger ---.
+//   grille proies -> décision prédateurs [p] -> physique prédateurs [p] -> captures -------------+-> morts
+//   morts -> graphique -> évolution
+//
+// Positions et vitesses sont en double tampon (EntityStore): toutes les
+// phases lisent l'état de fin du tick précédent, la physique écrit l'état
+// suivant et swapBuffers() le publie en toute fin de tick. Les deux grilles
+// sont donc construites dès le début, proies et prédateurs décident en même
+// temps, et manger/captures se résolvent sur les mêmes positions que la
+// perception. Deux phases ne tournent en même temps que si elles écrivent
+// des données différentes.
+//
+// Les temporaires du tick (graphe, matrices des cerveaux, captures...) sont
+// pris dans la ScratchArena de ce monde, remise à zéro ici. Les conteneurs
+// durables sont réservés (EntityStore, FoodIndex): en régime établi un tick
+// n'alloue sur le tas que si la nourriture dépasse la réserve du pool, ou
+// lors des naissances de l'évolution (voir AllocationCounter).
+// Pendant le graphe, seule la phase des captures puise dans l'arène.
+// ============================================================================
 void Simulation::update(float dt) {
     //std::cout<<dt<<std::endl;
+    const unsigned long long allocsBefore = AllocationCounter::count();
+    scratch.reset();
+
     timer += dt;
     graphUpdateTimer += dt;
     foodSpawnTimer += dt;
 
-    // Spawn nourriture périodique
-    if (foodSpawnTimer > 5.0f) {
-        spawnFood();
-        foodSpawnTimer = 0;
-    }
+    preyBrains.resize(preys.size(), scratch);
+    predatorBrains.resize(predators.size(), scratch);
+    preyOrder = orderBySlot(preys, preyStore, scratch);
+    predatorOrder = orderBySlot(predators, predatorStore, scratch);
+    const char* preyEaten = nullptr;
 
-    // Update proies
-    for (auto& prey : preys) {
-        prey->think(predators, foods);
-        prey->update(dt, GUI::res_width, GUI::res_height, terrain);
+    TaskGraph tick(scratch);
 
-        // Manger nourriture
-        for (auto& food : foods) {
-            if (!food->consumed && prey->distanceTo(food->pos) < 10.0f) {
-                prey->energy += food->energy;
+    // Spawn nourriture périodique
+    auto* spawn = tick.task([this] {
+        if (foodSpawnTimer > 5.0f) {
+            spawnFood();
+            foodSpawnTimer = 0;
+        }
+    });
+
+    // Index spatiaux de l'état courant: grille des prédateurs lue par
+    // Prey::sense, grille des proies lue par Predator::sense et les captures
+    auto* indexPredators = tick.task([this] { predatorGrid.rebuild(predators); });
+    auto* indexPreys = tick.task([this] { preyGrid.rebuild(preys); });
+
+    // Update proies: perception, inférence groupée, action, puis physique
+    // en bloc sur les colonnes
+    auto* thinkP = tick.parallelFor(preys.size(), THINK_CHUNK,
+                                    [this](size_t begin, size_t end) { thinkPreys(begin, end); });
+    auto* moveP = tick.parallelFor(preyStore.capacity(), INTEGRATE_CHUNK, [this, dt](size_t begin, size_t end) {
+        preyStore.integrate(dt, world.width, world.height, begin, end);
+    });
+
+    // Manger nourriture (retirée de l'index immédiatement, en série: la
+    // première proie servie dépend de l'ordre). Après la physique, qui
+    // écrit aussi l'énergie
+    auto* eat = tick.task([this] {
+        for (auto& prey : preys) {
+            foods.consumeInRadius(prey->pos(), Prey::EAT_RADIUS, [&prey](const Food& food) {
+                prey->energy() += food.energy;
                 prey->fitness += 30.0f;
-                prey->timeSinceLastMeal = 0;
-                food->consumed = true;
-            }
+                prey->timeSinceLastMeal() = 0;
+            });
         }
-    }
+    });
 
     // Update prédateurs
-    for (auto& pred : predators) {
-        pred->think(preys);
-        pred->update(dt, GUI::res_width, GUI::res_height, terrain);
-    }
-
-    // Captures
-    for (auto& pred : predators) {
-        preys.erase(
-            std::remove_if(preys.begin(), preys.end(),
-                           [&pred](const auto& prey) {
-                               if (pred->distanceTo(*prey) < pred->radius + prey->radius) {
-                                   pred->energy += 80;
-                                   pred->fitness += 150;
-                                   pred->kills++;
-                                   pred->timeSinceLastMeal = 0;
-                                   return true;
-                               }
-                               return false;
-                           }),
-            preys.end()
+    auto* thinkQ = tick.parallelFor(predators.size(), THINK_CHUNK,
+                                    [this](size_t begin, size_t end) { thinkPredators(begin, end); });
+    auto* moveQ = tick.parallelFor(predatorStore.capacity(), INTEGRATE_CHUNK, [this, dt](size_t begin, size_t end) {
+        predatorStore.integrate(dt, world.width, world.height, begin, end);
+    });
+
+    // Captures sur l'état courant (celui de preyGrid)
+    auto* capture = tick.task([this, &preyEaten] { preyEaten = resolveCaptures(scratch); });
+
+    auto* cull = tick.task([this, &preyEaten] {
+        // Mort par faim/vieillesse
+        predators.erase(
+            std::remove_if(predators.begin(), predators.end(),
+                           [](const auto& pred) { return pred->isDead() || pred->isStarving(); }),
+            predators.end()
             );
-    }
 
-    // Mort par faim/vieillesse
-    predators.erase(
-        std::remove_if(predators.begin(), predators.end(),
-                       [](const auto& pred) { return pred->isDead() || pred->isStarving(); }),
-        predators.end()
-        );
-
-    preys.erase(
-        std::remove_if(preys.begin(), preys.end(),
-                       [](const auto& prey) { return prey->isDead(); }),
-        preys.end()
-        );
-
-    // Nettoyer nourriture consommée
-    foods.erase(
-        std::remove_if(foods.begin(), foods.end(),
-                       [](const auto& food) { return food->consumed; }),
-        foods.end()
-        );
+        // Compaction unique des proies: mangées ou mortes
+        size_t kept = 0;
+        for (size_t i = 0; i < preys.size(); ++i) {
+            if (!preyEaten[i] && !preys[i]->isDead())
+                preys[kept++] = std::move(preys[i]);
+        }
+        preys.resize(kept);
+    });
 
     // Update du graphique
-    if (graphUpdateTimer > 0.3f) {
-        float preyAvg = 0, predAvg = 0;
-        if (!preys.empty()) {
-            for (const auto& p : preys) preyAvg += p->fitness;
-            preyAvg /= preys.size();
+    auto* plot = tick.task([this] {
+        if (graphUpdateTimer > 0.3f) {
+            float preyAvg = 0, predAvg = 0;
+            if (!preys.empty()) {
+                for (const auto& p : preys) preyAvg += p->fitness;
+                preyAvg /= preys.size();
+            }
+            if (!predators.empty()) {
+                for (const auto& p : predators) predAvg += p->fitness;
+                predAvg /= predators.size();
+            }
+            graph.addData(preyAvg, predAvg);
+            graphUpdateTimer = 0;
         }
-        if (!predators.empty()) {
-            for (const auto& p : predators) predAvg += p->fitness;
-            predAvg /= predators.size();
+    });
+
+    auto* generationEnd = tick.task([this] {
+        if (timer > gui.generationTime) {
+            evolve();
+            timer = 0;
         }
-        graph.addData(preyAvg, predAvg);
-        graphUpdateTimer = 0;
+    });
+
+    tick.precede(spawn, thinkP);
+    tick.precede(indexPredators, thinkP);
+    tick.precede(thinkP, moveP);
+    tick.precede(moveP, eat);
+    tick.precede(indexPreys, thinkQ);
+    tick.precede(thinkQ, moveQ);
+    tick.precede(moveQ, capture);
+    tick.precede(eat, cull);
+    tick.precede(capture, cull);
+    tick.precede(cull, plot);
+    tick.precede(plot, generationEnd);
+
+    TaskScheduler::shared().run(tick);
+
+    // Publication du nouvel état
+    preyStore.swapBuffers();
+    predatorStore.swapBuffers();
+    ++tickCount;
+
+    gui.debugMonitor.setValue("scratchKB", scratch.used() / 1024.0f);
+    if (AllocationCounter::enabled())
+        gui.debugMonitor.setValue("allocsPerTick", static_cast<float>(AllocationCounter::count() - allocsBefore));
+}
+
+// ============================================================================
+// THINK - PHASE DE DÉCISION PARALLÈLE
+// ============================================================================
+// sense() ne lit que l'état partagé (grilles, nourriture) et n'écrit que
+// dans l'entité elle-même (fitness, accélération) et sa ligne du batch;
+// act() de même. Chaque bloc de THINK_CHUNK entités enchaîne donc perception,
+// inférence et action sans synchronisation, sur n'importe quel thread.
+// La nourriture n'est mangée qu'après, en série (ordre déterministe).
+//
+// Le résultat ne dépend pas de l'ordre de parcours: on suit celui des slots
+// (preyOrder), pour que pos/vel/energy/acc soient lus et écrits en avançant
+// dans les colonnes. Reste une indirection par entité: le cerveau et les
+// champs froids (fitness, id...) sont dans l'objet Prey sur le tas, pas dans
+// des colonnes. Les rendre colonnes aussi (cerveaux indexés par slot)
+// obligerait evolve, la migration et le rendu à passer par le store pour
+// chaque champ: le gain restant est une lecture d'objet contigu de 1 Ko par
+// entité, déjà amortie par le produit matrice-vecteur qui le lit en entier.
+// ============================================================================
+template <typename T>
+T** Simulation::orderBySlot(const std::vector<std::unique_ptr<T>>& entities, const EntityStore& store,
+                            ScratchArena& arena) {
+    T** order = arena.allocate<T*>(store.capacity());
+    std::fill(order, order + store.capacity(), nullptr);
+    for (const auto& entity : entities)
+        order[entity->handle.slot] = entity.get();
+
+    // Compaction sur place des slots occupés (n <= slot)
+    size_t n = 0;
+    for (size_t slot = 0; slot < store.capacity(); ++slot)
+        if (order[slot])
+            order[n++] = order[slot];
+    return order;
+}
+
+void Simulation::thinkPreys(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        preyOrder[i]->sense(predatorGrid, foods, world, preyBrains.input(i));
+        preyBrains.setNetwork(i, &preyOrder[i]->brain);
     }
+    preyBrains.evaluate(begin, end);
+    for (size_t i = begin; i < end; ++i)
+        preyOrder[i]->act(preyBrains.output(i));
+}
 
-    if (timer > gui.generationTime) {
-        evolve();
-        timer = 0;
+void Simulation::thinkPredators(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        predatorOrder[i]->sense(preyGrid, world, predatorBrains.input(i));
+        predatorBrains.setNetwork(i, &predatorOrder[i]->brain);
     }
+    predatorBrains.evaluate(begin, end);
+    for (size_t i = begin; i < end; ++i)
+        predatorOrder[i]->act(predatorBrains.output(i));
+}
+
+// ============================================================================
+// CAPTURES - PHASE D'INTERACTION
+// ============================================================================
+// 1. Broadphase: chaque prédateur interroge la grille des proies dans son
+//    rayon de contact (rayon du prédateur + rayon d'une proie).
+// 2. Résolution déterministe: une proie n'est mangée qu'une fois, par le
+//    prédateur le plus proche (à distance égale, celui de plus petit index).
+// Les proies mangées sont seulement marquées; update() compacte la liste
+// une seule fois en fin de tick.
+// ============================================================================
+const char* Simulation::resolveCaptures(ScratchArena& scratch) {
+    char* preyEaten = scratch.allocate<char>(preys.size());
+    std::fill(preyEaten, preyEaten + preys.size(), 0);
+
+    ScratchVector<Capture> captures{ScratchAllocator<Capture>(scratch)};
+    captures.reserve(predators.size() * 2);
+
+    for (int p = 0; p < (int)predators.size(); ++p) {
+        const auto& pred = predators[p];
+        preyGrid.forEachInRadius(pred->pos(), pred->radius + Prey::RADIUS,
+                                 [&](const SpatialGrid::Hit& hit) {
+                                     captures.push_back({p, hit.index, hit.distance});
+                                 });
+    }
+
+    std::sort(captures.begin(), captures.end(), [](const Capture& a, const Capture& b) {
+        if (a.prey != b.prey) return a.prey < b.prey;
+        if (a.distance != b.distance) return a.distance < b.distance;
+        return a.pred < b.pred;
+    });
+
+    for (const auto& capture : captures) {
+        if (preyEaten[capture.prey]) continue;
+        preyEaten[capture.prey] = 1;
+
+        auto& pred = predators[capture.pred];
+        pred->energy() += 80;
+        pred->fitness += 150;
+        pred->kills++;
+        pred->timeSinceLastMeal() = 0;
+    }
+    return preyEaten;
 }
 
 void Simulation::evolve() {
+    // Bilan de la génération qui se termine
+    lastStats = GenerationStats();
+    lastStats.generation = generation;
+    lastStats.preys = preys.size();
+    lastStats.predators = predators.size();
+    lastStats.food = foods.size();
+    if (!preys.empty()) {
+        lastStats.preyBestFitness = preys.front()->fitness;
+        for (const auto& p : preys) {
+            lastStats.preyAvgFitness += p->fitness;
+            lastStats.preyBestFitness = std::max(lastStats.preyBestFitness, p->fitness);
+        }
+        lastStats.preyAvgFitness /= preys.size();
+    }
+    if (!predators.empty()) {
+        lastStats.predatorBestFitness = predators.front()->fitness;
+        for (const auto& p : predators) {
+            lastStats.predatorAvgFitness += p->fitness;
+            lastStats.predatorBestFitness = std::max(lastStats.predatorBestFitness, p->fitness);
+        }
+        lastStats.predatorAvgFitness /= predators.size();
+    }
+
     ++generation;
 
     // Évolution proies - garder survivants
@@ -360,16 +575,19 @@ void Simulation::evolve() {
         for (int i = 0; i < survivors && i < (int)preys.size(); ++i) {
             newGen.emplace_back(std::move(preys[i]));
             newGen.back()->fitness = 0;
-            newGen.back()->age = 0;
+            newGen.back()->age() = 0;
         }
 
         // Reproduction
         for (int i = 0; i < survivors && i < (int)newGen.size(); ++i) {
             for (int j = 0; j < 2; ++j) {
-                auto child = std::make_unique<Prey>(newGen[i]->pos.x + randFloat(-20, 20),
-                                                    newGen[i]->pos.y + randFloat(-20, 20));
-                child->brain = newGen[i]->brain->clone();
-                child->brain->mutate(gui.mutationRate);
+                const sf::Vector2f parent = newGen[i]->pos();
+                auto child = spawnEntity<Prey>(preyStore, parent - sf::Vector2f(20, 20), parent + sf::Vector2f(20, 20),
+                                               newGen[i]->brain);
+
+                // Flux de mutation propre à l'enfant
+                RandomStream mutationRng = stream(RandomPurpose::Mutation, child->id);
+                child->brain.mutate(gui.mutationRate, mutationRng);
                 child->generation = ++preyGeneration;
                 newGen.emplace_back(std::move(child));
             }
@@ -380,134 +598,79 @@ void Simulation::evolve() {
     // Réinitialiser si extinction
     if (preys.size() < 5) {
         for (int i = preys.size(); i < 15; ++i) {
-            preys.push_back(std::make_unique<Prey>(randFloat(50, GUI::res_width-50), randFloat(50, GUI::res_height-50)));
+            preys.push_back(spawnEntity<Prey>(preyStore, spawnMin(), spawnMax()));
         }
     }
 
     if (predators.size() < 2) {
         for (int i = predators.size(); i < 4; ++i) {
-            predators.push_back(std::make_unique<Predator>(randFloat(50, GUI::res_width-50), randFloat(50, GUI::res_height-50)));
+            predators.push_back(spawnEntity<Predator>(predatorStore, spawnMin(), spawnMax()));
         }
     }
 }
 
-void Simulation::draw(sf::RenderWindow& window, const sf::Font& font) {
-    // TERRAIN Enabled - Dessin du terrain commenté
-
-    // Dessiner terrain
-    for (const auto& tile : terrain) {
-        tile.draw(window);
-    }
-
-
-    // Dessiner nourriture
-    for (const auto& food : foods) {
-        food->draw(window);
-    }
-    //Dessiner la vitesse de chaque entitée
-    if (gui.showAverageSpeed) {
-        for (const auto& prey : preys) {
-            float avgSpeed = sqrt(pow(prey->vel.x, 2) + pow(prey->vel.y, 2));
-            std::stringstream ss;
-            ss << avgSpeed<<std::endl;
-            sf::Text speed(font);
-            speed.setString(ss.str());
-            speed.setCharacterSize(10);
-            speed.setPosition(prey->pos);
-            speed.setFillColor(sf::Color::White);
-            window.draw(speed);
-        }
-        for (const auto& pred : predators) {
-            float avgSpeed = sqrt(pow(pred->vel.x,2) + pow(pred->vel.y, 2));
-            std::stringstream ss;
-            ss << avgSpeed<<std::endl;
-            sf::Text speed(font);
-            speed.setString(ss.str());
-            speed.setCharacterSize(10);
-            speed.setPosition(pred->pos);
-            speed.setFillColor(sf::Color::White);
-            window.draw(speed);
-        }
-    }
-
-
-
-    // Dessiner cercles de détection
-    if (gui.showDetectionRadius) {
-        for (const auto& prey : preys) {
-            sf::CircleShape detectionCircle(Prey::DETECTION_RADIUS);
-            detectionCircle.setPosition(prey->pos - sf::Vector2f(Prey::DETECTION_RADIUS, Prey::DETECTION_RADIUS));
-            detectionCircle.setFillColor(sf::Color(0, 255, 0, 10));
-            detectionCircle.setOutlineColor(sf::Color(0, 255, 0, 30));
-            detectionCircle.setOutlineThickness(1);
-            window.draw(detectionCircle);
-        }
-
-        for (const auto& pred : predators) {
-            sf::CircleShape detectionCircle(Predator::DETECTION_RADIUS);
-            detectionCircle.setPosition(pred->pos - sf::Vector2f(Predator::DETECTION_RADIUS, Predator::DETECTION_RADIUS));
-            detectionCircle.setFillColor(sf::Color(255, 0, 0, 10));
-            detectionCircle.setOutlineColor(sf::Color(255, 0, 0, 30));
-            detectionCircle.setOutlineThickness(1);
-            window.draw(detectionCircle);
-        }
+// ============================================================================
+// SNAPSHOT - Copie de l'état pour le thread de rendu
+// ============================================================================
+// Appelée entre deux ticks par le thread de simulation. Les vecteurs de out
+// gardent leur capacité d'une copie à l'autre (TripleBuffer réutilise ses
+// cases): en régime établi, rien n'est alloué. Les copies sont rangées par
+// cellule (out.grid) pour que le rendu ne lise que ce qui est visible.
+// ============================================================================
+void Simulation::snapshot(WorldSnapshot& out) const {
+    auto copyEntity = [](const Entity& e) {
+        return EntitySnapshot{e.pos(), e.vel(), e.radius, e.color};
+    };
+    auto entityPos = [](const EntitySnapshot& e) { return e.pos; };
+
+    // Grille refaite seulement si la carte a changé de dimensions
+    if (out.world.width != world.width || out.world.height != world.height) {
+        out.world = world;
+        out.grid = SnapshotGrid(world.width, world.height);
     }
 
-    // Dessiner entités
-    for (const auto& prey : preys)
-        prey->draw(window, gui.showDirectionLines);
-
-
-    for (const auto& pred : predators)
-        pred->draw(window, gui.showDirectionLines);
-
-    // Stats
-    std::stringstream ss;
-    ss << "Generation: " << generation << "\n"
-       << "Proies: " << preys.size() << " (Gen " << preyGeneration << ")\n"
-       << "Predateurs: " << predators.size() << " (Gen " << predGeneration << ")\n"
-       << "Nourriture: " << foods.size() << "\n"
-       << "Temps: " << std::fixed << std::setprecision(1) << timer << "s / " << (int)gui.generationTime << "s\n";
-
+    out.grid.sort(out.preys, out.preyCells, entityPos, [&](auto&& emit) {
+        for (const auto& prey : preys)
+            emit(copyEntity(*prey));
+    });
+    out.grid.sort(out.predators, out.predatorCells, entityPos, [&](auto&& emit) {
+        for (const auto& pred : predators)
+            emit(copyEntity(*pred));
+    });
+    out.grid.sort(out.food, out.foodCells, [](sf::Vector2f p) { return p; }, [&](auto&& emit) {
+        foods.forEach([&emit](const Food& food) { emit(food.pos); });
+    });
+
+    out.terrain = terrain;
+    out.graph = graph;
+
+    out.generation = generation;
+    out.preyGeneration = preyGeneration;
+    out.predGeneration = predGeneration;
+    out.timer = timer;
+    out.generationTime = gui.generationTime;
+
+    out.preyAvgFitness = out.preyAvgEnergy = 0;
     if (!preys.empty()) {
-        float avgFit = 0, avgEnergy = 0;
         for (const auto& prey : preys) {
-            avgFit += prey->fitness;
-            avgEnergy += prey->energy;
+            out.preyAvgFitness += prey->fitness;
+            out.preyAvgEnergy += prey->energy();
         }
-        ss << "Proies Fitness: " << (int)(avgFit / preys.size())
-           << " | E: " << (int)(avgEnergy / preys.size()) << "\n";
+        out.preyAvgFitness /= preys.size();
+        out.preyAvgEnergy /= preys.size();
     }
 
+    out.predatorAvgFitness = out.predatorAvgHunger = 0;
+    out.totalKills = 0;
     if (!predators.empty()) {
-        float avgFit = 0;
-        int totalKills = 0;
-        float avgHunger = 0;
         for (const auto& pred : predators) {
-            avgFit += pred->fitness;
-            totalKills += pred->kills;
-            avgHunger += pred->timeSinceLastMeal;
+            out.predatorAvgFitness += pred->fitness;
+            out.totalKills += pred->kills;
+            out.predatorAvgHunger += pred->timeSinceLastMeal();
         }
-        ss << "Preds Fitness: " << (int)(avgFit / predators.size()) << "\n"
-           << "Captures: " << totalKills
-           << " | Faim: " << std::setprecision(1) << (avgHunger / predators.size()) << "s";
+        out.predatorAvgFitness /= predators.size();
+        out.predatorAvgHunger /= predators.size();
     }
 
-    sf::Text text(font);
-    text.setString(ss.str());
-    text.setFont(font);
-    text.setCharacterSize(11);
-    text.setPosition({10, 10});
-    text.setFillColor(sf::Color::White);
-    text.setOutlineColor(sf::Color::Black);
-    text.setOutlineThickness(1);
-    window.draw(text);
-
-    // Dessiner graphique et GUI
-    graph.draw(window, font);
-    gui.draw(window, font);
-}
-
-void Simulation::handleKeyPress(sf::Keyboard::Key key) {
-    gui.handleInput(key);
+    out.debugValues = gui.debugMonitor.getValues();
 }
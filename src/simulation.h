@@ -2,12 +2,44 @@
 #define SIMULATION_H
 #include "entity.h"
 #include "gui.h"
+#include "brainbatch.h"
+#include "scratcharena.h"
+#include "taskscheduler.h"
+#include "randomstream.h"
+#include "worldsnapshot.h"
+#include "worldconfig.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <vector>
 #include <random>
 #include <memory>
+#include <cstdint>
+
+// ============================================================================
+// SIMULATION CONFIG - Paramètres de départ d'un monde
+// ============================================================================
+// Avec une graine non nulle, terrain, populations et mutations sont
+// reproductibles d'un lancement à l'autre, quel que soit le nombre de threads.
+// ============================================================================
+struct SimulationConfig {
+    uint32_t seed = 0;          // 0: graine aléatoire (std::random_device)
+    int initialPreys = 25;
+    int initialPredators = 6;
+    WorldConfig world;          // Dimensions de la carte
+};
+
+// Bilan d'une génération, relevé par evolve() juste avant la sélection
+struct GenerationStats {
+    int generation = 0;
+    size_t preys = 0;
+    size_t predators = 0;
+    size_t food = 0;
+    float preyAvgFitness = 0;
+    float preyBestFitness = 0;
+    float predatorAvgFitness = 0;
+    float predatorBestFitness = 0;
+};
 
 // ============================================================================
 // SIMULATION - Gère l'écosystème complet (proies, prédateurs, nourriture)
@@ -20,11 +52,56 @@
 
 class Simulation {
 private:
+    // Dimensions de la carte. Déclarées en premier: les index spatiaux
+    // ci-dessous en dépendent
+    const WorldConfig world;
+
     // ========== ENTITÉS ET ENVIRONNEMENT ==========
+    // Colonnes des champs chauds de chaque espèce. Déclarées AVANT les
+    // entités: elles doivent leur survivre (~Entity rend son slot au store).
+    EntityStore preyStore;
+    EntityStore predatorStore;
+
+    // Propriétaires des entités, dans l'ordre de la simulation (evolve les
+    // trie par fitness, eat les sert dans cet ordre). Les phases qui ne
+    // dépendent pas de l'ordre les parcourent par slot (voir preyOrder).
     std::vector<std::unique_ptr<Prey>> preys;
     std::vector<std::unique_ptr<Predator>> predators;
-    std::vector<std::unique_ptr<Food>> foods;
-    std::vector<TerrainTile> terrain;
+    static constexpr size_t FOOD_RESERVE_SPAWNS = 64;   // Voir le constructeur
+    FoodIndex foods;  // Cellules petites (rayon de détection / 4): manger ne lit que quelques Food
+    // Jamais modifié en place: generateTerrain() en publie un nouveau
+    std::shared_ptr<const std::vector<TerrainTile>> terrain;
+
+    // ========== INDEX SPATIAUX (reconstruits à chaque tick) ==========
+    // Taille de cellule de la grille des prédateurs (interrogée par les
+    // proies): leur rayon de détection. Celle des proies (cherchées par les
+    // prédateurs): la moitié du rayon de chasse, deux anneaux couvrent donc
+    // toute la zone de chasse. La nourriture a son propre index (FoodIndex).
+    SpatialGrid preyGrid;
+    SpatialGrid predatorGrid;
+
+    // ========== PHASE D'INTERACTION (captures) ==========
+    // Paires prédateur/proie en contact trouvées par la grille des proies
+    struct Capture {
+        int pred;
+        int prey;
+        float distance;
+    };
+
+    // ========== INFÉRENCE GROUPÉE (une matrice par espèce, dans l'arène) ==========
+    BrainBatch<Prey::Brain> preyBrains;
+    BrainBatch<Predator::Brain> predatorBrains;
+
+    // Entités du tick par slot croissant (tableaux de l'arène): la phase de
+    // décision lit ainsi les colonnes de l'EntityStore dans l'ordre, au lieu
+    // de l'ordre de preys qu'evolve() a trié par fitness
+    Prey** preyOrder = nullptr;
+    Predator** predatorOrder = nullptr;
+
+    // Taille des blocs des boucles parallèles du tick. Fixe: le découpage
+    // (et donc le résultat) ne dépend pas du nombre de threads
+    static constexpr size_t THINK_CHUNK = 64;        // Entités par bloc (décision)
+    static constexpr size_t INTEGRATE_CHUNK = 1024;  // Slots par bloc (physique)
 
     // ========== GESTION DU TEMPS ET DES GÉNÉRATIONS ==========
     int generation;
@@ -42,17 +119,47 @@ private:
     float graphUpdateTimer;
     float foodSpawnTimer;
 
+    GenerationStats lastStats;
+
+    // ========== ÉTAT PROPRE AU MONDE ==========
+    // Rien de mutable n'est partagé entre deux Simulation: plusieurs mondes
+    // peuvent avancer en parallèle (WorldRunner). Pas de générateur à état:
+    // chaque tirage ouvre un RandomStream clé par (seed, usage, tick, id).
+    uint32_t seed;
+    uint64_t tickCount;
+    uint32_t nextEntityId;
+    // Temporaires du tick (graphe, matrices des cerveaux, captures)
+    ScratchArena scratch;
+
+    // Zone d'apparition des entités placées au hasard sur la carte: toute la
+    // carte sauf une marge de SPAWN_MARGIN sur chaque bord
+    static constexpr float SPAWN_MARGIN = 50.0f;
+    sf::Vector2f spawnMin() const { return {SPAWN_MARGIN, SPAWN_MARGIN}; }
+    sf::Vector2f spawnMax() const { return world.size() - spawnMin(); }
+
     // ========== FONCTIONS PRIVÉES ==========
-    static std::mt19937& getRNG();
-    static float randFloat(float min, float max);
-    static int randInt(int min, int max);
+    // Flux de ce monde pour purpose au tick courant
+    RandomStream stream(RandomPurpose purpose, uint32_t id = 0) const;
+    // args (un cerveau à copier, par exemple) suivent (store, x, y) dans le
+    // constructeur de T; sans args, c'est le flux de la naissance
+    template <typename T, typename... Args>
+    std::unique_ptr<T> spawnEntity(EntityStore& store, sf::Vector2f min, sf::Vector2f max, Args&&... args);
     void generateTerrain();
     void spawnFood();
+    // Retourne un drapeau par proie (1 = mangée), pris dans l'arène du tick
+    const char* resolveCaptures(ScratchArena& scratch);
+    // entities par slot croissant, dans un tableau de l'arène
+    template <typename T>
+    static T** orderBySlot(const std::vector<std::unique_ptr<T>>& entities, const EntityStore& store,
+                           ScratchArena& arena);
+    // Perception, inférence et action des entités [begin, end) d'une espèce
+    void thinkPreys(size_t begin, size_t end);
+    void thinkPredators(size_t begin, size_t end);
 
 public:
     // CONSTRUCTEUR: Prend une RÉFÉRENCE à l'instance GUI unique
     // Cette référence est stockée et utilisée tout au long de la simulation
-    Simulation(GUI::GUIControls& guiControls);
+    Simulation(GUI::GUIControls& guiControls, const SimulationConfig& config = SimulationConfig());
 
     // Met à jour la simulation à chaque frame
     void update(float dt);
@@ -60,10 +167,31 @@ public:
     // Fait évoluer les populations (sélection naturelle)
     void evolve();
 
-    // Dessine tout sur l'écran
-    void draw(sf::RenderWindow& window, const sf::Font& font);
+    // Copie l'état à dessiner (le rendu a son propre thread, voir WorldRenderer)
+    void snapshot(WorldSnapshot& out) const;
+
+    // ========== LECTURE DE L'ÉTAT (mode headless, statistiques) ==========
+    int getGeneration() const { return generation; }
+    const GenerationStats& lastGenerationStats() const { return lastStats; }
+    const std::vector<std::unique_ptr<Prey>>& getPreys() const { return preys; }
+    const std::vector<std::unique_ptr<Predator>>& getPredators() const { return predators; }
+    size_t foodCount() const { return foods.size(); }
+    const WorldConfig& worldConfig() const { return world; }
 
-    // Gère les touches du clavier
-    void handleKeyPress(sf::Keyboard::Key key);
+    // ========== MIGRATION (modèle en îles, voir IslandModel) ==========
+    // Juste après evolve(): chaque migrant remplace le cerveau d'un des
+    // enfants les plus récents (fin de liste), les survivants restent.
+    // receive(brain) y copie un génome et rend false s'il n'y en a plus.
+    template <typename Receive>
+    size_t receivePreyMigrants(size_t max, Receive&& receive) {
+        size_t count = 0;
+        while (count < max && count < preys.size()) {
+            Prey& prey = *preys[preys.size() - 1 - count];
+            if (!receive(prey.brain)) break;
+            prey.generation = ++preyGeneration;
+            ++count;
+        }
+        return count;
+    }
 };
 #endif // SIMULATION_H
@@ -0,0 +1,75 @@
+#include "simulationthread.h"
+#include "fixedtimestep.h"
+#include <SFML/System.hpp>
+#include <chrono>
+
+// Pas de simulation fixe (une frame à 60 FPS), indépendant du rendu
+static constexpr float SIM_STEP = 1.0f / 60.0f;
+// Au plus 1000 pas par rafale (1000x à 60 FPS)...
+static constexpr int MAX_SUBSTEPS = 1000;
+// ...et un snapshot publié au moins toutes les 16 ms, même à pleine vitesse
+static constexpr float PUBLISH_INTERVAL = 0.016f;
+
+SimulationThread::SimulationThread(const SimulationConfig& config) {
+    sim = std::make_unique<Simulation>(controls, config);
+
+    // Premier monde publié avant le démarrage: latest() a toujours une valeur
+    sim->snapshot(snapshots.back());
+    snapshots.publish();
+
+    thread = std::thread([this] { loop(); });
+}
+
+SimulationThread::~SimulationThread() {
+    stopping = true;
+    thread.join();
+}
+
+void SimulationThread::setControls(const GUI::GUIControls& gui) {
+    ControlParams& next = params.back();
+    next.mutationRate = gui.mutationRate;
+    next.generationTime = gui.generationTime;
+    next.fastForwardRate = gui.fastForwardRate;
+    params.publish();
+}
+
+const WorldSnapshot& SimulationThread::latest() {
+    snapshots.update();
+    return snapshots.front();
+}
+
+void SimulationThread::loop() {
+    FixedTimestep timestep(SIM_STEP, MAX_SUBSTEPS);
+    sf::Clock clock;
+
+    while (!stopping.load()) {
+        if (params.update()) {
+            const ControlParams& p = params.front();
+            controls.mutationRate = p.mutationRate;
+            controls.generationTime = p.generationTime;
+            controls.fastForwardRate = p.fastForwardRate;
+        }
+
+        // Autant de pas fixes que le temps réel écoulé x fastForwardRate
+        const int steps = timestep.beginFrame(clock.restart().asSeconds(), controls.fastForwardRate);
+        sf::Clock budget;
+        int stepsRun = 0;
+        while (stepsRun < steps && budget.getElapsedTime().asSeconds() < PUBLISH_INTERVAL) {
+            sim->update(timestep.step());
+            ++stepsRun;
+        }
+        timestep.endFrame(stepsRun);
+
+        if (stepsRun == 0) {
+            // En avance sur le temps réel: rien à faire avant le prochain pas
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        controls.debugMonitor.setValue("simSteps", static_cast<float>(stepsRun));
+        WorldSnapshot& world = snapshots.back();
+        sim->snapshot(world);
+        world.achievedSpeed = timestep.achievedRatio();
+        snapshots.publish();
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef SIMULATIONTHREAD_H
+#define SIMULATIONTHREAD_H
+#include "simulation.h"
+#include "worldsnapshot.h"
+#include "triplebuffer.h"
+#include "gui.h"
+#include <thread>
+#include <atomic>
+#include <memory>
+
+// Paramètres réglés au clavier que la simulation doit suivre
+struct ControlParams {
+    float mutationRate = 0.15f;
+    float generationTime = 30.0f;
+    float fastForwardRate = 1.0f;
+};
+
+// ============================================================================
+// SIMULATION THREAD - La simulation tourne à côté de la fenêtre
+// ============================================================================
+// SFML veut la fenêtre (événements et dessin) sur le thread principal: c'est
+// donc la simulation qui part sur son propre thread, avec sa boucle à pas
+// fixe (FixedTimestep). Les deux côtés ne se parlent que par deux
+// TripleBuffer, sans verrou ni attente:
+//   simulation -> fenêtre: un WorldSnapshot après chaque rafale de pas
+//   fenêtre -> simulation: les ControlParams courants (touches Q/W, etc.)
+// Une frame lente ne ralentit pas la simulation, et une simulation à 1000x
+// ne fige pas la fenêtre.
+// ============================================================================
+class SimulationThread {
+public:
+    explicit SimulationThread(const SimulationConfig& config = SimulationConfig());
+    ~SimulationThread();  // Arrête et attend le thread
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // ========== CÔTÉ FENÊTRE ==========
+    void setControls(const GUI::GUIControls& gui);
+    // Dernier monde publié (toujours valide: le premier est publié à la construction)
+    const WorldSnapshot& latest();
+
+private:
+    // Copie des contrôles propre au thread de simulation (la Simulation la
+    // référence, et y écrit son debug monitor)
+    GUI::GUIControls controls;
+    std::unique_ptr<Simulation> sim;
+
+    TripleBuffer<WorldSnapshot> snapshots;
+    TripleBuffer<ControlParams> params;
+
+    std::atomic<bool> stopping{false};
+    std::thread thread;
+
+    void loop();
+};
+
+#endif // SIMULATIONTHREAD_H
@@ -0,0 +1,13 @@
+#include "snapshotgrid.h"
+
+SnapshotGrid::SnapshotGrid(float width, float height, float cellSize)
+    : GridLayout(width, height, cellSize) {}
+
+SnapshotGrid::CellRange SnapshotGrid::cellsIn(const sf::FloatRect& rect) const {
+    CellRange range;
+    range.x0 = cellX(rect.position.x);
+    range.y0 = cellY(rect.position.y);
+    range.x1 = cellX(rect.position.x + rect.size.x);
+    range.y1 = cellY(rect.position.y + rect.size.y);
+    return range;
+}
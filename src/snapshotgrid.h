@@ -0,0 +1,61 @@
+#ifndef SNAPSHOTGRID_H
+#define SNAPSHOTGRID_H
+#include "spatialgrid.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// ============================================================================
+// SNAPSHOT GRID - Index spatial des snapshots pour le rendu
+// ============================================================================
+// Le thread de simulation range les copies du snapshot par cellule au moment
+// où il les écrit (tri par comptage, comme SpatialGrid::build). Le rendu n'a
+// plus qu'à lire les cellules qui recoupent la vue: le coût du dessin suit ce
+// qui est visible, pas la taille de la population. Le nombre d'éléments par
+// cellule sert aussi directement de densité pour le rendu de loin.
+// ============================================================================
+class SnapshotGrid : private GridLayout {
+public:
+    static constexpr float CELL_SIZE = 25.0f;
+
+    // Cellules [x0, x1] x [y0, y1], bornes comprises
+    struct CellRange {
+        int x0 = 0, y0 = 0, x1 = -1, y1 = -1;
+    };
+
+    SnapshotGrid(float width, float height, float cellSize = CELL_SIZE);
+
+    // Remplit out avec les éléments émis par visit(emit), rangés par cellule
+    // selon position(élément). start[c] reçoit le début de la cellule c dans
+    // out (cols*rows + 1 entrées). visit est appelée deux fois (comptage puis
+    // placement) et doit émettre la même séquence.
+    template <typename T, typename Position, typename Visit>
+    void sort(std::vector<T>& out, std::vector<int>& start, Position&& position, Visit&& visit);
+
+    // Cellules qui recoupent rect (bornées à la carte)
+    CellRange cellsIn(const sf::FloatRect& rect) const;
+
+    int cell(int x, int y) const { return y * cols + x; }
+    int columns() const { return cols; }
+    int rowCount() const { return rows; }
+    sf::Vector2f cellSize() const { return {cellW, cellH}; }
+
+private:
+    std::vector<int> cursor;   // Curseurs d'écriture utilisés par sort()
+};
+
+template <typename T, typename Position, typename Visit>
+void SnapshotGrid::sort(std::vector<T>& out, std::vector<int>& start, Position&& position, Visit&& visit) {
+    const int numCells = cols * rows;
+    start.assign(numCells + 1, 0);
+
+    visit([&](const T& item) { ++start[cellOf(position(item)) + 1]; });
+
+    for (int c = 0; c < numCells; ++c)
+        start[c + 1] += start[c];
+
+    out.resize(start[numCells]);
+    cursor.assign(start.begin(), start.end() - 1);
+    visit([&](const T& item) { out[cursor[cellOf(position(item))]++] = item; });
+}
+
+#endif // SNAPSHOTGRID_H
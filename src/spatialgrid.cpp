@@ -0,0 +1,88 @@
+#include "spatialgrid.h"
+#include <algorithm>
+#include <cmath>
+
+GridLayout::GridLayout(float width, float height, float cellSize)
+    : width(width), height(height),
+      cols(std::max(1, (int)(width / cellSize))),
+      rows(std::max(1, (int)(height / cellSize))),
+      cellW(width / cols), cellH(height / rows) {}
+
+int GridLayout::cellX(float x) const {
+    return std::clamp((int)(x / cellW), 0, cols - 1);
+}
+
+int GridLayout::cellY(float y) const {
+    return std::clamp((int)(y / cellH), 0, rows - 1);
+}
+
+SpatialGrid::SpatialGrid(float width, float height, float cellSize)
+    : GridLayout(width, height, cellSize),
+      cellStart(cols * rows + 1, 0) {}
+
+// ============================================================================
+// BUILD - TRI PAR COMPTAGE
+// ============================================================================
+// 1. Compter les points de chaque cellule
+// 2. Somme préfixe -> début de chaque cellule
+// 3. Placer chaque point à sa position triée
+// Aucun conteneur par cellule: les vecteurs sont réutilisés d'un tick à l'autre.
+// ============================================================================
+void SpatialGrid::build() {
+    const int numCells = cols * rows;
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+
+    for (const auto& p : points)
+        ++cellStart[cellOf(p) + 1];
+
+    for (int c = 0; c < numCells; ++c)
+        cellStart[c + 1] += cellStart[c];
+
+    sortedIndex.resize(points.size());
+    sortedPos.resize(points.size());
+
+    // Curseur d'écriture par cellule (copie des débuts)
+    cursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < (int)points.size(); ++i) {
+        const int cell = cellOf(points[i]);
+        const int slot = cursor[cell]++;
+        sortedIndex[slot] = i;
+        sortedPos[slot] = points[i];
+    }
+}
+
+// ============================================================================
+// K PLUS PROCHES VOISINS
+// ============================================================================
+// Même parcours par anneaux que nearest(), mais on garde les k meilleurs
+// candidats triés (insertion) et on s'arrête quand l'anneau suivant ne peut
+// plus battre le k-ième.
+// ============================================================================
+void SpatialGrid::kNearest(sf::Vector2f center, int k, std::vector<Hit>& out) const {
+    out.clear();
+    if (points.empty() || k <= 0) return;
+
+    const int cx = cellX(center.x);
+    const int cy = cellY(center.y);
+
+    for (int r = 0; r <= maxRing(); ++r) {
+        if ((int)out.size() == k) {
+            const float bound = ringBound(r);
+            if (bound > 0 && bound >= out.back().distance) break;
+        }
+
+        forEachCellInRing(cx, cy, r, [&](int cell) {
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                const sf::Vector2f d = delta(center, sortedPos[i]);
+                const float dist = std::sqrt(d.x * d.x + d.y * d.y);
+                if ((int)out.size() == k && dist >= out.back().distance) continue;
+
+                Hit hit{sortedIndex[i], sortedPos[i], d, dist};
+                auto it = std::upper_bound(out.begin(), out.end(), dist,
+                                           [](float value, const Hit& h) { return value < h.distance; });
+                out.insert(it, hit);
+                if ((int)out.size() > k) out.pop_back();
+            }
+        });
+    }
+}
@@ -0,0 +1,236 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+#include <SFML/System.hpp>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// ============================================================================
+// TORE - Distances sur une carte qui boucle sur ses bords
+// ============================================================================
+// Entity::update fait réapparaître les entités de l'autre côté de la carte:
+// deux points proches de part et d'autre d'un bord sont donc voisins. On
+// prend toujours la plus courte des images périodiques ("minimum image").
+// ============================================================================
+namespace Torus {
+    // Vecteur le plus court allant de from vers to
+    inline sf::Vector2f delta(sf::Vector2f from, sf::Vector2f to, float width, float height) {
+        sf::Vector2f d = to - from;
+        if (d.x > width * 0.5f) d.x -= width;
+        else if (d.x < -width * 0.5f) d.x += width;
+        if (d.y > height * 0.5f) d.y -= height;
+        else if (d.y < -height * 0.5f) d.y += height;
+        return d;
+    }
+
+    inline float distance(sf::Vector2f a, sf::Vector2f b, float width, float height) {
+        const sf::Vector2f d = delta(a, b, width, height);
+        return std::sqrt(d.x * d.x + d.y * d.y);
+    }
+
+    // Image de p dans [0, width) x [0, height)
+    inline sf::Vector2f wrap(sf::Vector2f p, float width, float height) {
+        p.x -= std::floor(p.x / width) * width;
+        p.y -= std::floor(p.y / height) * height;
+        // L'arrondi peut rendre exactement width pour un p.x minuscule négatif
+        if (p.x >= width) p.x = 0;
+        if (p.y >= height) p.y = 0;
+        return p;
+    }
+}
+
+// ============================================================================
+// GRID LAYOUT - Découpage périodique de la carte en cellules
+// ============================================================================
+// Géométrie commune aux index spatiaux (SpatialGrid, FoodIndex): calcul de
+// la cellule d'un point et parcours par anneaux qui bouclent sur les bords.
+// La taille de cellule est arrondie au-dessus pour diviser exactement la
+// carte (sinon la dernière cellule, plus petite, fausserait les bornes).
+// ============================================================================
+class GridLayout {
+public:
+    GridLayout(float width, float height, float cellSize);
+
+    sf::Vector2f delta(sf::Vector2f from, sf::Vector2f to) const {
+        return Torus::delta(from, to, width, height);
+    }
+
+    float getCellSize() const { return std::min(cellW, cellH); }
+
+protected:
+    float width, height;
+    int cols, rows;
+    float cellW, cellH;
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+    int cellOf(sf::Vector2f p) const { return cellY(p.y) * cols + cellX(p.x); }
+
+    // Appelle fn(cell) pour chaque cellule de l'anneau r autour de (cx, cy).
+    // Les décalages sont bornés à une demi-carte: chaque cellule n'est vue
+    // qu'une seule fois même quand l'anneau fait le tour du tore.
+    template <typename Fn>
+    void forEachCellInRing(int cx, int cy, int r, Fn&& fn) const;
+
+    int maxRing() const { return std::max(cols, rows) / 2 + 1; }
+
+    // Borne inférieure de la distance aux points de l'anneau r
+    float ringBound(int r) const { return (r - 1) * getCellSize(); }
+};
+
+template <typename Fn>
+void GridLayout::forEachCellInRing(int cx, int cy, int r, Fn&& fn) const {
+    const int loX = -(cols / 2), hiX = (cols - 1) / 2;
+    const int loY = -(rows / 2), hiY = (rows - 1) / 2;
+
+    auto visit = [&](int dx, int dy) {
+        const int x = ((cx + dx) % cols + cols) % cols;
+        const int y = ((cy + dy) % rows + rows) % rows;
+        fn(y * cols + x);
+    };
+
+    for (int dy = std::max(-r, loY); dy <= std::min(r, hiY); ++dy) {
+        if (dy == -r || dy == r) {
+            // Lignes du haut et du bas: toute la largeur de l'anneau
+            for (int dx = std::max(-r, loX); dx <= std::min(r, hiX); ++dx)
+                visit(dx, dy);
+        } else {
+            // Lignes intérieures: seulement les deux colonnes du bord
+            if (-r >= loX) visit(-r, dy);
+            if (r <= hiX && r != -r) visit(r, dy);
+        }
+    }
+}
+
+// ============================================================================
+// SPATIAL GRID - Grille uniforme périodique pour les recherches de voisins
+// ============================================================================
+// La carte est découpée en cellules de taille fixe. Chaque tick, la grille
+// est reconstruite en O(N) (tri par comptage des points par cellule), puis
+// les requêtes n'explorent que les anneaux de cellules autour du point au
+// lieu de parcourir toute la population. Les anneaux bouclent sur les bords
+// et les distances/directions retournées sont celles du tore.
+// Les indices retournés sont ceux du conteneur source passé à rebuild().
+// ============================================================================
+class SpatialGrid : private GridLayout {
+public:
+    // Résultat d'une requête: index dans le conteneur source (-1 si rien),
+    // position de la cible et vecteur le plus court depuis le centre
+    struct Hit {
+        int index = -1;
+        sf::Vector2f pos;
+        sf::Vector2f delta;
+        float distance = 1e6f;
+    };
+
+    SpatialGrid(float width, float height, float cellSize);
+
+    // Reconstruit la grille à partir d'un conteneur de pointeurs
+    // (std::vector<std::unique_ptr<T>>) dont les éléments ont une méthode pos()
+    template <typename Container>
+    void rebuild(const Container& items) {
+        points.clear();
+        points.reserve(items.size());
+        for (const auto& item : items)
+            points.push_back(item->pos());
+        build();
+    }
+
+    // Plus proche voisin de center (toute la carte est explorée si besoin)
+    Hit nearest(sf::Vector2f center) const {
+        return nearest(center, [](int) { return true; });
+    }
+
+    // Plus proche voisin parmi les éléments acceptés par accept(index)
+    template <typename Accept>
+    Hit nearest(sf::Vector2f center, Accept&& accept) const;
+
+    // Les k plus proches voisins, triés par distance croissante
+    void kNearest(sf::Vector2f center, int k, std::vector<Hit>& out) const;
+
+    // Appelle fn(hit) pour chaque élément à moins de radius de center
+    template <typename Fn>
+    void forEachInRadius(sf::Vector2f center, float radius, Fn&& fn) const;
+
+    using GridLayout::delta;
+    using GridLayout::getCellSize;
+    size_t size() const { return points.size(); }
+
+private:
+    std::vector<sf::Vector2f> points;     // Positions dans l'ordre du conteneur source
+    std::vector<int> cellStart;           // Début de chaque cellule dans sortedIndex (cols*rows + 1)
+    std::vector<int> sortedIndex;         // Indices source triés par cellule
+    std::vector<sf::Vector2f> sortedPos;  // Positions triées par cellule (lecture contiguë)
+    std::vector<int> cursor;              // Curseurs d'écriture utilisés par build()
+
+    void build();
+};
+
+// ============================================================================
+// RECHERCHE PAR ANNEAUX
+// ============================================================================
+// On explore l'anneau 0 (cellule du point), puis l'anneau 1 (8 voisines),
+// etc. Un point de l'anneau r est au moins à (r-1)*cellSize du centre: dès
+// que le meilleur candidat est plus proche que cette borne, on s'arrête.
+// ============================================================================
+template <typename Accept>
+SpatialGrid::Hit SpatialGrid::nearest(sf::Vector2f center, Accept&& accept) const {
+    Hit best;
+    if (points.empty()) return best;
+
+    const int cx = cellX(center.x);
+    const int cy = cellY(center.y);
+    float bestD2 = std::numeric_limits<float>::max();
+
+    for (int r = 0; r <= maxRing(); ++r) {
+        if (best.index >= 0) {
+            const float bound = ringBound(r);
+            if (bound > 0 && bound * bound >= bestD2) break;
+        }
+
+        forEachCellInRing(cx, cy, r, [&](int cell) {
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                const sf::Vector2f d = delta(center, sortedPos[k]);
+                const float d2 = d.x * d.x + d.y * d.y;
+                if (d2 < bestD2 && accept(sortedIndex[k])) {
+                    bestD2 = d2;
+                    best.index = sortedIndex[k];
+                    best.pos = sortedPos[k];
+                    best.delta = d;
+                }
+            }
+        });
+    }
+
+    if (best.index >= 0)
+        best.distance = std::sqrt(bestD2);
+    return best;
+}
+
+// ============================================================================
+// RECHERCHE PAR RAYON
+// ============================================================================
+// Seuls les anneaux dont la borne inférieure est sous le rayon sont visités.
+// ============================================================================
+template <typename Fn>
+void SpatialGrid::forEachInRadius(sf::Vector2f center, float radius, Fn&& fn) const {
+    if (points.empty()) return;
+
+    const int cx = cellX(center.x);
+    const int cy = cellY(center.y);
+    const float r2 = radius * radius;
+
+    for (int r = 0; r <= maxRing() && ringBound(r) < radius; ++r) {
+        forEachCellInRing(cx, cy, r, [&](int cell) {
+            for (int k = cellStart[cell]; k < cellStart[cell + 1]; ++k) {
+                const sf::Vector2f d = delta(center, sortedPos[k]);
+                const float d2 = d.x * d.x + d.y * d.y;
+                if (d2 < r2)
+                    fn(Hit{sortedIndex[k], sortedPos[k], d, std::sqrt(d2)});
+            }
+        });
+    }
+}
+
+#endif // SPATIALGRID_H
@@ -8,9 +8,7 @@ class Food {
 public:
     sf::Vector2f pos;
     float energy;
-    bool consumed;
 
     Food(float x, float y, float e = 50.0f);
-    void draw(sf::RenderWindow& window) const;
 };
 #endif // SURVIVALLOGIC_H
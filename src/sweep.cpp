@@ -0,0 +1,181 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "worldrunner.h"
+#include "commandline.h"
+
+// ============================================================================
+// SWEEP - Balayage de paramètres sur un lot de mondes parallèles
+// ============================================================================
+// Produit cartésien des taux de mutation, des durées de génération et des
+// graines: chaque combinaison est un monde indépendant, et tout le lot tourne
+// en même temps sur le TaskScheduler (voir WorldRunner). Le CSV de sortie a
+// une ligne par génération et par monde.
+//
+// Exemple: sweep --mutation-rates 0.05,0.15,0.3 --generation-times 20,40
+//                --seeds 1-8 --ticks 216000 --output sweep.csv
+// ============================================================================
+
+struct SweepOptions {
+    std::vector<float> mutationRates{0.15f};
+    std::vector<float> generationTimes{30.0f};
+    std::vector<uint32_t> seeds{1};
+    long long ticks = 60 * 60 * 30;  // 30 minutes simulées par monde
+    float dt = 1.0f / 60.0f;
+    int initialPreys = 25;
+    int initialPredators = 6;
+    WorldConfig world;
+    std::string outputPath;
+};
+
+static void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "  --mutation-rates R,R,...    taux de mutation (defaut 0.15)\n"
+              << "  --generation-times S,S,...  durees de generation en s (defaut 30)\n"
+              << "  --seeds A-B | N,N,...       graines (defaut 1)\n"
+              << "  --ticks N                   ticks par monde (defaut 108000)\n"
+              << "  --dt S                      pas de temps (defaut 1/60)\n"
+              << "  --preys N                   proies au depart (defaut 25)\n"
+              << "  --predators N               predateurs au depart (defaut 6)\n"
+              << "  --world-width W             largeur du monde (defaut 800)\n"
+              << "  --world-height H            hauteur du monde (defaut 800)\n"
+              << "  --output FICHIER            CSV des resultats (defaut: sortie standard)\n";
+}
+
+// "0.05,0.1,0.2" -> {0.05, 0.1, 0.2}
+static bool parseFloatList(const std::string& text, std::vector<float>& values) {
+    values.clear();
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        float value = 0;
+        if (!CommandLine::parse(item.c_str(), value) || value <= 0) return false;
+        values.push_back(value);
+    }
+    return !values.empty();
+}
+
+// "1-8" ou "3,7,42" (0 est réservé à la graine aléatoire)
+static bool parseSeeds(const std::string& text, std::vector<uint32_t>& seeds) {
+    seeds.clear();
+    const size_t dash = text.find('-');
+    if (dash != std::string::npos) {
+        uint32_t first = 0, last = 0;
+        if (!CommandLine::parse(text.substr(0, dash).c_str(), first)
+            || !CommandLine::parse(text.substr(dash + 1).c_str(), last)
+            || first == 0 || last < first) return false;
+        for (uint64_t seed = first; seed <= last; ++seed)
+            seeds.push_back((uint32_t)seed);
+        return true;
+    }
+
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        uint32_t seed = 0;
+        if (!CommandLine::parse(item.c_str(), seed) || seed == 0) return false;
+        seeds.push_back(seed);
+    }
+    return !seeds.empty();
+}
+
+// Retourne false (après un message) si la ligne de commande est invalide
+static bool parseOptions(int argc, char** argv, SweepOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Option sans valeur: " << arg << "\n";
+            return false;
+        }
+        const char* value = argv[++i];
+
+        bool ok = true;
+        if (arg == "--mutation-rates") ok = parseFloatList(value, options.mutationRates);
+        else if (arg == "--generation-times") ok = parseFloatList(value, options.generationTimes);
+        else if (arg == "--seeds") ok = parseSeeds(value, options.seeds);
+        else if (arg == "--ticks") ok = CommandLine::parse(value, options.ticks);
+        else if (arg == "--dt") ok = CommandLine::parse(value, options.dt);
+        else if (arg == "--preys") ok = CommandLine::parse(value, options.initialPreys);
+        else if (arg == "--predators") ok = CommandLine::parse(value, options.initialPredators);
+        else if (arg == "--world-width") ok = CommandLine::parse(value, options.world.width);
+        else if (arg == "--world-height") ok = CommandLine::parse(value, options.world.height);
+        else if (arg == "--output") options.outputPath = value;
+        else {
+            std::cerr << "Option inconnue: " << arg << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Valeur invalide pour " << arg << ": " << value << "\n";
+            return false;
+        }
+    }
+
+    if (options.ticks < 0 || options.dt <= 0 || options.initialPreys < 0 || options.initialPredators < 0) {
+        std::cerr << "Valeur invalide (ticks, dt et populations doivent etre positifs)\n";
+        return false;
+    }
+    if (!options.world.valid()) {
+        std::cerr << "Valeur invalide (le monde doit mesurer au moins " << WorldConfig::MIN_SIZE << " de cote)\n";
+        return false;
+    }
+    return true;
+}
+
+// ============ MAIN ============
+int main(int argc, char** argv) {
+    SweepOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<WorldSpec> specs;
+    for (float mutationRate : options.mutationRates) {
+        for (float generationTime : options.generationTimes) {
+            for (uint32_t seed : options.seeds) {
+                WorldSpec spec;
+                spec.config.seed = seed;
+                spec.config.initialPreys = options.initialPreys;
+                spec.config.initialPredators = options.initialPredators;
+                spec.config.world = options.world;
+                spec.mutationRate = mutationRate;
+                spec.generationTime = generationTime;
+                spec.ticks = options.ticks;
+                spec.dt = options.dt;
+                specs.push_back(spec);
+            }
+        }
+    }
+
+    std::ofstream file;
+    if (!options.outputPath.empty()) {
+        file.open(options.outputPath);
+        if (!file) {
+            std::cerr << "Impossible d'ecrire " << options.outputPath << "\n";
+            return 1;
+        }
+    }
+
+    std::cerr << specs.size() << " mondes, " << options.ticks << " ticks chacun, "
+              << TaskScheduler::shared().size() << " threads\n";
+
+    const auto start = std::chrono::steady_clock::now();
+    WorldRunner runner(specs);
+    ResultsSink sink;
+    runner.run(sink);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    sink.writeCsv(file.is_open() ? file : std::cout, runner.worlds());
+
+    const double ticks = (double)options.ticks * specs.size();
+    std::cerr << ticks << " ticks en " << seconds << " s"
+              << ", " << (seconds > 0 ? ticks / seconds : 0) << " ticks/s"
+              << ", x" << (seconds > 0 ? ticks * options.dt / seconds : 0) << " temps reel cumule\n";
+    return 0;
+}
@@ -0,0 +1,256 @@
+#include "taskscheduler.h"
+#include <cstdlib>
+#include <algorithm>
+
+// Index de la file du thread courant (-1 hors des workers et de run())
+static thread_local int workerIndex = -1;
+// Graphe de la tâche en cours d'exécution sur ce thread (parent des run() imbriqués)
+static thread_local TaskGraph* currentGraph = nullptr;
+
+// ============================================================================
+// TASK GRAPH
+// ============================================================================
+TaskGraph::Node* TaskGraph::addNode(void (*invoke)(void*, size_t, size_t), void* fn,
+                                    size_t count, size_t chunk) {
+    if (chunk == 0) chunk = 1;
+
+    Node* node = new (arena.allocate<Node>(1)) Node();
+    node->invoke = invoke;
+    node->fn = fn;
+    node->count = count;
+    node->chunk = chunk;
+    node->chunks = (count + chunk - 1) / chunk;
+    node->tasks = arena.allocate<Task>(std::max<size_t>(node->chunks, 1));
+    node->graph = this;
+    nodes.push_back(node);
+    return node;
+}
+
+bool TaskGraph::descendsFrom(const TaskGraph* ancestor) const {
+    for (const TaskGraph* g = this; g; g = g->parent)
+        if (g == ancestor) return true;
+    return false;
+}
+
+void TaskGraph::precede(Node* before, Node* after) {
+    Edge* edge = arena.allocate<Edge>(1);
+    edge->to = after;
+    edge->next = before->successors;
+    before->successors = edge;
+    after->dependencies++;
+}
+
+// ============================================================================
+// FILES DE TRAVAIL
+// ============================================================================
+// Une tâche refusée reste en place: la pile d'un thread qui attend a, au
+// dessus de son point d'entrée, les tâches de son graphe; en dessous, celles
+// de la tâche interrompue, que les workers libres viendront voler.
+// ============================================================================
+bool TaskScheduler::WorkQueue::push(Task* task) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tail - head == Capacity) return false;
+    ring[tail++ % Capacity] = task;
+    return true;
+}
+
+TaskScheduler::Task* TaskScheduler::WorkQueue::pop(const TaskGraph* waiting) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tail == head || !acceptable(ring[(tail - 1) % Capacity], waiting)) return nullptr;
+    return ring[--tail % Capacity];
+}
+
+TaskScheduler::Task* TaskScheduler::WorkQueue::steal(const TaskGraph* waiting) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tail == head || !acceptable(ring[head % Capacity], waiting)) return nullptr;
+    return ring[head++ % Capacity];
+}
+
+// ============================================================================
+// TASK SCHEDULER
+// ============================================================================
+TaskScheduler::TaskScheduler(unsigned threads) : queues(std::max(1u, threads)) {
+    for (unsigned i = 0; i + 1 < threads; ++i)
+        workers.emplace_back([this, i] { workerLoop(i); });
+}
+
+TaskScheduler::~TaskScheduler() {
+    stopping = true;
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wake.notify_all();
+    }
+    for (auto& worker : workers)
+        worker.join();
+}
+
+TaskScheduler& TaskScheduler::shared() {
+    static TaskScheduler scheduler([] {
+        if (const char* env = std::getenv("BIOSIM_THREADS")) {
+            const int n = std::atoi(env);
+            if (n > 0) return (unsigned)n;
+        }
+        return std::max(1u, std::thread::hardware_concurrency());
+    }());
+    return scheduler;
+}
+
+void TaskScheduler::push(Task* task, unsigned self) {
+    // File pleine: on exécute sur place plutôt que d'allouer
+    if (!queues[self].push(task)) {
+        execute(task, self);
+        return;
+    }
+
+    signal();
+}
+
+// Réveille les threads endormis (voir workerLoop pour l'ordre)
+void TaskScheduler::signal() {
+    epoch.fetch_add(1);
+    if (sleepers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wake.notify_all();
+    }
+}
+
+TaskScheduler::Task* TaskScheduler::findTask(unsigned self, const TaskGraph* waiting) {
+    if (Task* task = queues[self].pop(waiting))
+        return task;
+
+    // Vol: on parcourt les autres files à partir de la voisine
+    const unsigned n = (unsigned)queues.size();
+    for (unsigned k = 1; k < n; ++k)
+        if (Task* task = queues[(self + k) % n].steal(waiting))
+            return task;
+    return nullptr;
+}
+
+void TaskScheduler::schedule(Node* node, unsigned self) {
+    if (node->chunks == 0) {
+        complete(node, self);
+        return;
+    }
+    Task* root = &node->tasks[0];
+    root->node = node;
+    root->begin = 0;
+    root->end = node->chunks;
+    push(root, self);
+}
+
+// ============================================================================
+// EXÉCUTION D'UNE TÂCHE
+// ============================================================================
+// On publie la moitié haute tant qu'il reste plus d'un bloc, puis on
+// exécute le bloc restant.
+// ============================================================================
+void TaskScheduler::execute(Task* task, unsigned self) {
+    Node* node = task->node;
+    const size_t begin = task->begin;
+    size_t end = task->end;
+
+    while (end - begin > 1) {
+        const size_t mid = begin + (end - begin) / 2;
+        Task* upper = &node->tasks[mid];
+        upper->node = node;
+        upper->begin = mid;
+        upper->end = end;
+        push(upper, self);
+        end = mid;
+    }
+
+    // Les run() lancés par ce bloc sont des enfants de son graphe
+    TaskGraph* const previousGraph = currentGraph;
+    currentGraph = node->graph;
+    const size_t first = begin * node->chunk;
+    node->invoke(node->fn, first, std::min(first + node->chunk, node->count));
+    currentGraph = previousGraph;
+
+    if (node->remainingChunks.fetch_sub(1) == 1)
+        complete(node, self);
+}
+
+void TaskScheduler::complete(Node* node, unsigned self) {
+    for (TaskGraph::Edge* edge = node->successors; edge; edge = edge->next)
+        if (edge->to->waitingFor.fetch_sub(1) == 1)
+            schedule(edge->to, self);
+
+    // En dernier: run() ne doit pas rendre la main avant les successeurs.
+    // Le graphe peut être détruit dès que son compteur tombe à zéro: on ne
+    // le touche plus ensuite, on réveille seulement celui qui l'attend.
+    if (node->graph->remainingNodes.fetch_sub(1) == 1)
+        signal();
+}
+
+// ============================================================================
+// ATTENTE D'UN GRAPHE
+// ============================================================================
+// Le thread exécute les tâches acceptables du graphe; s'il n'en trouve pas
+// (elles sont chez d'autres threads), il s'endort comme un worker jusqu'à
+// la prochaine publication ou la fin d'un graphe, au lieu de tourner à vide.
+// ============================================================================
+void TaskScheduler::runUntilDone(TaskGraph& graph, unsigned self) {
+    auto done = [&graph] { return graph.remainingNodes.load() == 0; };
+    while (!done()) {
+        const uint64_t seen = epoch.load();
+        if (Task* task = findTask(self, &graph)) {
+            execute(task, self);
+            continue;
+        }
+        park(seen, done);
+    }
+}
+
+void TaskScheduler::run(TaskGraph& graph) {
+    if (graph.nodes.empty()) return;
+
+    for (Node* node : graph.nodes) {
+        node->remainingChunks.store(node->chunks);
+        node->waitingFor.store(node->dependencies);
+    }
+    graph.remainingNodes.store(graph.nodes.size());
+    graph.parent = currentGraph;
+
+    // Depuis un worker (ou depuis une tâche exécutée par le thread externe
+    // pendant son run): on reste sur sa file. Sinon: la file externe, que le
+    // thread garde jusqu'à la fin pour que ses run() imbriqués y restent.
+    std::unique_lock<std::mutex> external(externalMutex, std::defer_lock);
+    unsigned self;
+    if (workerIndex >= 0) {
+        self = (unsigned)workerIndex;
+    } else {
+        external.lock();
+        self = (unsigned)queues.size() - 1;
+        workerIndex = (int)self;
+    }
+
+    for (Node* node : graph.nodes)
+        if (node->dependencies == 0)
+            schedule(node, self);
+
+    runUntilDone(graph, self);
+
+    if (external.owns_lock())
+        workerIndex = -1;
+}
+
+// ============================================================================
+// BOUCLE DES WORKERS
+// ============================================================================
+// Un worker sans travail s'endort jusqu'à la prochaine publication. epoch
+// est lu AVANT de chercher du travail: une tâche publiée pendant la
+// recherche change epoch et empêche l'endormissement.
+// ============================================================================
+void TaskScheduler::workerLoop(unsigned index) {
+    workerIndex = (int)index;
+
+    while (!stopping.load()) {
+        const uint64_t seen = epoch.load();
+        if (Task* task = findTask(index, nullptr)) {
+            execute(task, index);
+            continue;
+        }
+
+        park(seen, [] { return false; });
+    }
+}
@@ -0,0 +1,216 @@
+#ifndef TASKSCHEDULER_H
+#define TASKSCHEDULER_H
+#include "scratcharena.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+class TaskScheduler;
+
+// ============================================================================
+// TASK GRAPH - Phases d'un tick et leurs dépendances
+// ============================================================================
+// Un noeud est soit une tâche simple (task), soit une boucle parallèle
+// (parallelFor) découpée en blocs de taille fixe. precede(a, b) impose que
+// b ne démarre qu'une fois a terminé. Tout (noeuds, tâches, liens, copies
+// des lambdas) est pris dans une ScratchArena: construire et exécuter un
+// graphe n'alloue rien sur le tas. Les lambdas doivent être trivialement
+// destructibles (captures par référence) et le graphe ne doit pas survivre
+// au reset() de l'arène.
+// ============================================================================
+class TaskGraph {
+public:
+    struct Node;
+
+    explicit TaskGraph(ScratchArena& arena) : arena(arena) {}
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    // fn()
+    template <typename Fn>
+    Node* task(Fn&& fn);
+
+    // fn(begin, end) pour chaque bloc de chunk indices de [0, count)
+    template <typename Fn>
+    Node* parallelFor(size_t count, size_t chunk, Fn&& fn);
+
+    void precede(Node* before, Node* after);
+
+private:
+    friend class TaskScheduler;
+
+    // Un intervalle de blocs [begin, end) d'un noeud. Le noeud réserve une
+    // Task par bloc: une tâche coupée en deux range sa moitié haute dans
+    // tasks[mid], chaque case sert donc au plus une fois par exécution.
+    struct Task {
+        Node* node;
+        size_t begin, end;
+    };
+
+    struct Edge {
+        Node* to;
+        Edge* next;
+    };
+
+public:
+    struct Node {
+        void (*invoke)(void* fn, size_t begin, size_t end);
+        void* fn;
+        size_t count, chunk, chunks;
+        Task* tasks;
+        Edge* successors = nullptr;
+        int dependencies = 0;
+        std::atomic<size_t> remainingChunks{0};
+        std::atomic<int> waitingFor{0};
+        TaskGraph* graph;
+    };
+
+private:
+    ScratchArena& arena;
+    std::vector<Node*, ScratchAllocator<Node*>> nodes{ScratchAllocator<Node*>(arena)};
+    std::atomic<size_t> remainingNodes{0};
+    // Graphe de la tâche qui a lancé run() (nullptr: lancé hors de toute
+    // tâche). Fixé par run(); le parent survit toujours à l'enfant.
+    TaskGraph* parent = nullptr;
+
+    // Vrai si ce graphe est ancestor ou un de ses descendants
+    bool descendsFrom(const TaskGraph* ancestor) const;
+
+    template <typename Fn>
+    void* store(Fn&& fn);
+    Node* addNode(void (*invoke)(void*, size_t, size_t), void* fn, size_t count, size_t chunk);
+};
+
+// ============================================================================
+// TASK SCHEDULER - Ordonnanceur à vol de travail
+// ============================================================================
+// Chaque thread a sa file de tâches. Il dépile les siennes par la fin (les
+// plus récentes, encore en cache) et, quand elle est vide, vole la plus
+// ancienne d'une autre file. Une boucle parallèle démarre comme une seule
+// tâche couvrant tous ses blocs; la tâche garde sa moitié basse et publie la
+// moitié haute, récursivement jusqu'à un bloc. Les voleurs prennent donc
+// les plus gros morceaux, et une région dense (blocs lents) n'immobilise
+// pas les autres coeurs: ils viennent lui prendre le reste du travail.
+//
+// Le découpage en blocs ne dépend que de count et chunk: tant que chaque
+// bloc n'écrit que dans ses propres données, le résultat ne dépend ni du
+// nombre de threads ni de qui a volé quoi.
+//
+// run(graph) bloque jusqu'à la fin du graphe; le thread appelant exécute
+// des tâches en attendant: une tâche peut elle-même appeler run (réentrant).
+// En attendant, il ne prend QUE les tâches de ce graphe ou des graphes
+// lancés par ses tâches: un thread qui attend le tick d'un monde ne démarre
+// pas un autre monde entier dans cette attente (l'imbrication reste bornée
+// par la profondeur des graphes, pas par le nombre de mondes).
+// Sans tâche acceptable, il dort comme un worker libre (variable de
+// condition wake) jusqu'à une publication ou la fin d'un graphe.
+// Le nombre de threads vient de BIOSIM_THREADS s'il est défini, sinon du
+// nombre de coeurs.
+// ============================================================================
+class TaskScheduler {
+public:
+    // threads = nombre total de threads, thread appelant compris
+    explicit TaskScheduler(unsigned threads);
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    unsigned size() const { return (unsigned)workers.size() + 1; }
+
+    void run(TaskGraph& graph);
+
+    // Ordonnanceur partagé par tout le programme
+    static TaskScheduler& shared();
+
+private:
+    using Task = TaskGraph::Task;
+    using Node = TaskGraph::Node;
+
+    // File d'un thread: anneau de capacité fixe (pas d'allocation) protégé
+    // par un mutex. Le propriétaire travaille à la fin, les voleurs au début.
+    struct alignas(64) WorkQueue {
+        static constexpr size_t Capacity = 4096;
+        std::mutex mutex;
+        Task* ring[Capacity];
+        size_t head = 0, tail = 0;
+
+        bool push(Task* task);
+        // nullptr si vide ou si la tâche au bord n'est pas acceptée par
+        // waiting (voir acceptable)
+        Task* pop(const TaskGraph* waiting);
+        Task* steal(const TaskGraph* waiting);
+    };
+
+    // Une tâche peut être exécutée par un thread qui attend waiting
+    // (nullptr: worker libre, tout est accepté)
+    static bool acceptable(const Task* task, const TaskGraph* waiting) {
+        return !waiting || task->node->graph->descendsFrom(waiting);
+    }
+
+    std::vector<std::thread> workers;
+    std::vector<WorkQueue> queues;   // Une par worker + une pour le thread externe
+    std::mutex externalMutex;        // Un seul run() externe à la fois
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<uint64_t> epoch{0};  // Incrémenté à chaque publication ou fin de graphe
+    std::atomic<int> sleepers{0};
+    std::atomic<bool> stopping{false};
+
+    void workerLoop(unsigned index);
+    void schedule(Node* node, unsigned self);
+    void push(Task* task, unsigned self);
+    void signal();
+    // Endort le thread jusqu'à la prochaine publication après seen (ou done())
+    template <typename Done>
+    void park(uint64_t seen, Done&& done);
+    Task* findTask(unsigned self, const TaskGraph* waiting);
+    void execute(Task* task, unsigned self);
+    void complete(Node* node, unsigned self);
+    void runUntilDone(TaskGraph& graph, unsigned self);
+};
+
+// ============================================================================
+// CONSTRUCTION DU GRAPHE
+// ============================================================================
+template <typename Fn>
+void* TaskGraph::store(Fn&& fn) {
+    using F = typename std::decay<Fn>::type;
+    static_assert(std::is_trivially_destructible<F>::value,
+                  "les lambdas du graphe vivent dans l'arène (captures par référence)");
+    return new (arena.allocate(sizeof(F), alignof(F) < ScratchArena::Align ? alignof(F) : ScratchArena::Align))
+        F(std::forward<Fn>(fn));
+}
+
+template <typename Fn>
+TaskGraph::Node* TaskGraph::task(Fn&& fn) {
+    using F = typename std::decay<Fn>::type;
+    return addNode([](void* f, size_t, size_t) { (*static_cast<F*>(f))(); },
+                   store(std::forward<Fn>(fn)), 1, 1);
+}
+
+template <typename Fn>
+TaskGraph::Node* TaskGraph::parallelFor(size_t count, size_t chunk, Fn&& fn) {
+    using F = typename std::decay<Fn>::type;
+    return addNode([](void* f, size_t begin, size_t end) { (*static_cast<F*>(f))(begin, end); },
+                   store(std::forward<Fn>(fn)), count, chunk);
+}
+
+template <typename Done>
+void TaskScheduler::park(uint64_t seen, Done&& done) {
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    sleepers.fetch_add(1);
+    wake.wait(lock, [&] { return stopping.load() || epoch.load() != seen || done(); });
+    sleepers.fetch_sub(1);
+}
+
+#endif // TASKSCHEDULER_H
@@ -35,9 +35,9 @@ bool TerrainTile::collidesWith(sf::Vector2f pos, float radius) const {
     return false;
 }
 
-void TerrainTile::draw(sf::RenderWindow& window) const {
-    window.draw(shape);
+void TerrainTile::draw(sf::RenderTarget& target) const {
+    target.draw(shape);
     for (const auto& obs : obstacles) {
-        window.draw(obs);
+        target.draw(obs);
     }
 }
@@ -24,7 +24,7 @@ struct TerrainTile {
     void setAsPolygon(const std::vector<sf::Vector2f>& points, sf::Color color);
     void addRock(const std::vector<sf::Vector2f>& points, sf::Color color);
     bool collidesWith(sf::Vector2f pos, float radius) const;
-    void draw(sf::RenderWindow& window) const;
+    void draw(sf::RenderTarget& target) const;
 };
 
 #endif // TERRAINTIPE_H
@@ -0,0 +1,108 @@
+#include "textoverlay.h"
+
+// Quad d'un glyphe en deux triangles, avec la marge d'un pixel de sf::Text
+static void appendGlyphQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f pen, sf::Color color,
+                            const sf::Glyph& glyph) {
+    constexpr float padding = 1.0f;
+
+    const float left = glyph.bounds.position.x - padding;
+    const float top = glyph.bounds.position.y - padding;
+    const float right = glyph.bounds.position.x + glyph.bounds.size.x + padding;
+    const float bottom = glyph.bounds.position.y + glyph.bounds.size.y + padding;
+
+    const float u1 = static_cast<float>(glyph.textureRect.position.x) - padding;
+    const float v1 = static_cast<float>(glyph.textureRect.position.y) - padding;
+    const float u2 = static_cast<float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + padding;
+    const float v2 = static_cast<float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + padding;
+
+    vertices.push_back({pen + sf::Vector2f(left, top), color, {u1, v1}});
+    vertices.push_back({pen + sf::Vector2f(right, top), color, {u2, v1}});
+    vertices.push_back({pen + sf::Vector2f(left, bottom), color, {u1, v2}});
+    vertices.push_back({pen + sf::Vector2f(left, bottom), color, {u1, v2}});
+    vertices.push_back({pen + sf::Vector2f(right, top), color, {u2, v1}});
+    vertices.push_back({pen + sf::Vector2f(right, bottom), color, {u2, v2}});
+}
+
+// ============================================================================
+// TEXT BATCH
+// ============================================================================
+TextBatch::TextBatch(unsigned characterSize, float outlineThickness)
+    : characterSize(characterSize), outlineThickness(outlineThickness) {}
+
+void TextBatch::clear() {
+    outlineVertices.clear();
+    fillVertices.clear();
+}
+
+void TextBatch::prepare(const sf::Font& newFont) {
+    if (font == &newFont) return;
+    font = &newFont;
+
+    for (char c = FIRST_CHAR; c <= LAST_CHAR; ++c) {
+        GlyphPair& g = glyphs[c - FIRST_CHAR];
+        g.fill = font->getGlyph(static_cast<std::uint32_t>(c), characterSize, false);
+        if (outlineThickness > 0)
+            g.outline = font->getGlyph(static_cast<std::uint32_t>(c), characterSize, false, outlineThickness);
+    }
+    whitespace = glyphs[0].fill.advance;
+    lineSpacing = font->getLineSpacing(characterSize);
+}
+
+void TextBatch::append(const sf::Font& font, std::string_view text, sf::Vector2f position,
+                       sf::Color fill, sf::Color outline) {
+    prepare(font);
+
+    // Même origine que sf::Text: la ligne de base est à characterSize du haut
+    float x = 0;
+    float y = static_cast<float>(characterSize);
+    for (char c : text) {
+        if (c == '\n') {
+            x = 0;
+            y += lineSpacing;
+            continue;
+        }
+        if (c == ' ') {
+            x += whitespace;
+            continue;
+        }
+        if (c == '\t') {
+            x += whitespace * 4;
+            continue;
+        }
+        if (c < FIRST_CHAR || c > LAST_CHAR) c = '?';
+
+        const GlyphPair& g = glyphs[c - FIRST_CHAR];
+        const sf::Vector2f pen = position + sf::Vector2f(x, y);
+        if (outlineThickness > 0)
+            appendGlyphQuad(outlineVertices, pen, outline, g.outline);
+        appendGlyphQuad(fillVertices, pen, fill, g.fill);
+        x += g.fill.advance;
+    }
+}
+
+void TextBatch::draw(sf::RenderTarget& target) const {
+    if (!font || fillVertices.empty()) return;
+
+    // La page est relue à chaque dessin: SFML l'agrandit quand des glyphes
+    // sont chargés, les coordonnées (en pixels) restent valides
+    const sf::RenderStates states(&font->getTexture(characterSize));
+    if (!outlineVertices.empty())
+        target.draw(outlineVertices.data(), outlineVertices.size(), sf::PrimitiveType::Triangles, states);
+    target.draw(fillVertices.data(), fillVertices.size(), sf::PrimitiveType::Triangles, states);
+}
+
+// ============================================================================
+// CACHED TEXT
+// ============================================================================
+CachedText::CachedText(unsigned characterSize, sf::Vector2f position, sf::Color fill,
+                       float outlineThickness, sf::Color outline)
+    : batch(characterSize, outlineThickness), position(position), fill(fill), outline(outline) {}
+
+void CachedText::setString(const sf::Font& font, std::string_view text) {
+    if (laidOutFont == &font && current == text) return;
+    laidOutFont = &font;
+    current = text;
+
+    batch.clear();
+    batch.append(font, current, position, fill, outline);
+}
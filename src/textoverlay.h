@@ -0,0 +1,89 @@
+#ifndef TEXTOVERLAY_H
+#define TEXTOVERLAY_H
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ============================================================================
+// TEXT BATCH - Texte regroupé en un tableau de quads de glyphes
+// ============================================================================
+// sf::Text refait sa mise en page (une recherche de glyphe par caractère dans
+// la police, des sommets neufs) à chaque changement de chaîne et coûte un
+// appel de dessin par texte. Un TextBatch lit une fois les glyphes ASCII
+// d'une taille de police et ajoute les quads de chaque texte à la suite dans
+// un tableau: tous les textes du lot partagent la page de texture de la
+// police (l'atlas de glyphes de SFML) et se dessinent en UN appel (deux avec
+// contour: contours d'abord, puis remplissage, comme sf::Text).
+//
+// Mise en page identique à sf::Text, sans crénage (négligeable pour des
+// nombres et des libellés courts). Hors ASCII imprimable: '?'.
+// ============================================================================
+class TextBatch {
+public:
+    explicit TextBatch(unsigned characterSize, float outlineThickness = 0);
+
+    void clear();
+
+    // Ajoute text avec son coin haut-gauche en position (comme
+    // sf::Text::setPosition). Relit les glyphes si la police change.
+    void append(const sf::Font& font, std::string_view text, sf::Vector2f position,
+                sf::Color fill, sf::Color outline = sf::Color::Black);
+
+    void draw(sf::RenderTarget& target) const;
+
+    bool empty() const { return fillVertices.empty(); }
+
+private:
+    static constexpr char FIRST_CHAR = ' ';
+    static constexpr char LAST_CHAR = '~';
+
+    struct GlyphPair {
+        sf::Glyph fill;
+        sf::Glyph outline;
+    };
+
+    void prepare(const sf::Font& newFont);
+
+    unsigned characterSize;
+    float outlineThickness;
+
+    // ========== GLYPHES (relus si la police change) ==========
+    const sf::Font* font = nullptr;
+    std::array<GlyphPair, LAST_CHAR - FIRST_CHAR + 1> glyphs{};
+    float whitespace = 0;
+    float lineSpacing = 0;
+
+    // ========== SOMMETS (capacité conservée d'un clear() à l'autre) ==========
+    std::vector<sf::Vertex> outlineVertices;
+    std::vector<sf::Vertex> fillVertices;
+};
+
+// ============================================================================
+// CACHED TEXT - Texte fixe dont la mise en page n'est refaite qu'au changement
+// ============================================================================
+// Pour les panneaux (statistiques, contrôles, debug monitor): la chaîne est
+// reformatée à chaque frame dans un tampon réutilisé, mais les quads ne sont
+// recalculés que si elle diffère de la précédente (ou si la police change).
+// ============================================================================
+class CachedText {
+public:
+    CachedText(unsigned characterSize, sf::Vector2f position, sf::Color fill,
+               float outlineThickness = 0, sf::Color outline = sf::Color::Black);
+
+    void setString(const sf::Font& font, std::string_view text);
+
+    void draw(sf::RenderTarget& target) const { batch.draw(target); }
+
+private:
+    TextBatch batch;
+    sf::Vector2f position;
+    sf::Color fill;
+    sf::Color outline;
+
+    std::string current;
+    const sf::Font* laidOutFont = nullptr;
+};
+
+#endif // TEXTOVERLAY_H
@@ -0,0 +1,49 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+#include <array>
+#include <atomic>
+
+// ============================================================================
+// TRIPLE BUFFER - Dernière valeur publiée, sans verrou ni attente
+// ============================================================================
+// Un écrivain et un lecteur, chacun sur son thread. L'écrivain remplit
+// back() puis publish(); le lecteur appelle update() puis lit front(). Les
+// trois cases tournent: une en écriture, une en lecture, et la dernière
+// publiée au milieu. Aucun des deux ne bloque l'autre; si l'écrivain publie
+// plus vite que le lecteur ne lit, les valeurs intermédiaires sont sautées.
+//
+// back() n'est pas remis à zéro: il contient une ancienne valeur, que
+// l'écrivain réécrit (les vecteurs gardent ainsi leur capacité).
+// ============================================================================
+template <typename T>
+class TripleBuffer {
+public:
+    // ========== CÔTÉ ÉCRIVAIN ==========
+    T& back() { return slots[backIndex]; }
+
+    void publish() {
+        backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // ========== CÔTÉ LECTEUR ==========
+    // true si une nouvelle valeur est passée dans front()
+    bool update() {
+        if (!(middle.load(std::memory_order_acquire) & FRESH))
+            return false;
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    const T& front() const { return slots[frontIndex]; }
+
+private:
+    static constexpr int INDEX = 3;   // Indice de la case du milieu
+    static constexpr int FRESH = 4;   // Publiée et pas encore lue
+
+    std::array<T, 3> slots{};
+    int backIndex = 0;                // Propriété de l'écrivain
+    int frontIndex = 1;               // Propriété du lecteur
+    alignas(64) std::atomic<int> middle{2};
+};
+
+#endif // TRIPLEBUFFER_H
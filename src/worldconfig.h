@@ -0,0 +1,32 @@
+#ifndef WORLDCONFIG_H
+#define WORLDCONFIG_H
+#include <SFML/System.hpp>
+
+// ============================================================================
+// WORLD CONFIG - Dimensions du monde simulé
+// ============================================================================
+// Indépendantes de la fenêtre (GUI::res_width/res_height): le monde peut
+// être bien plus grand que l'écran, la Camera n'en montre qu'une partie.
+// Bornes du tore, zones d'apparition, normalisation des entrées des
+// cerveaux, terrain, index spatiaux et rendu lisent tous ces valeurs.
+// ============================================================================
+struct WorldConfig {
+    // Monde de référence: celui pour lequel les quantités (nourriture par
+    // apparition) ont été réglées
+    static constexpr float REFERENCE_SIZE = 800.0f;
+    // Plus petit côté accepté (le terrain place ses lacs à 100 des bords)
+    static constexpr float MIN_SIZE = 300.0f;
+
+    float width = REFERENCE_SIZE;
+    float height = REFERENCE_SIZE;
+
+    bool valid() const { return width >= MIN_SIZE && height >= MIN_SIZE; }
+
+    sf::Vector2f size() const { return {width, height}; }
+    sf::Vector2f center() const { return {width / 2, height / 2}; }
+
+    // Surface relative au monde de référence (1 pour 800x800)
+    float areaRatio() const { return width * height / (REFERENCE_SIZE * REFERENCE_SIZE); }
+};
+
+#endif // WORLDCONFIG_H
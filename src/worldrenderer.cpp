@@ -0,0 +1,335 @@
+#include "worldrenderer.h"
+#include <array>
+#include <cmath>
+#include <cstdio>
+
+// ============================================================================
+// CERCLE UNITÉ
+// ============================================================================
+// Points du cercle unité pour un nombre de segments donné (le dernier point
+// reprend le premier), calculés une fois par nombre de segments. Disques et
+// gabarits de détection se construisent en mettant ces points à l'échelle.
+// ============================================================================
+template <int Segments>
+static const std::array<sf::Vector2f, Segments + 1>& unitCircle() {
+    static const std::array<sf::Vector2f, Segments + 1> points = [] {
+        std::array<sf::Vector2f, Segments + 1> p;
+        for (int i = 0; i <= Segments; ++i) {
+            const float angle = i * 2.0f * 3.14159265f / Segments;
+            p[i] = {std::cos(angle), std::sin(angle)};
+        }
+        return p;
+    }();
+    return points;
+}
+
+// ============================================================================
+// DISQUES EN TRIANGLES
+// ============================================================================
+// Un disque = Segments triangles (centre, bord i, bord i+1), ajoutés à la
+// suite dans la couche: une couche entière se dessine en Triangles.
+// ============================================================================
+static constexpr int DISC_SEGMENTS = 12;
+static constexpr int FOOD_SEGMENTS = 6;   // Petits disques: moins de points
+
+template <int Segments>
+static void appendDisc(std::vector<sf::Vertex>& layer, sf::Vector2f center, float radius,
+                       sf::Color color) {
+    const auto& circle = unitCircle<Segments>();
+    for (int i = 0; i < Segments; ++i) {
+        layer.push_back({center, color});
+        layer.push_back({center + circle[i] * radius, color});
+        layer.push_back({center + circle[i + 1] * radius, color});
+    }
+}
+
+// ============================================================================
+// GABARIT DE DÉTECTION
+// ============================================================================
+// Même rendu qu'un sf::CircleShape de 30 points: disque translucide, puis
+// contour de 1 pixel vers l'extérieur, en triangles autour de l'origine.
+// Le gabarit est le cercle unité mis à l'échelle une fois pour toutes.
+// ============================================================================
+static constexpr int DETECTION_SEGMENTS = 30;
+
+static std::vector<sf::Vertex> buildDetectionTemplate(float radius, sf::Color color) {
+    const sf::Color fill(color.r, color.g, color.b, 10);
+    const sf::Color outline(color.r, color.g, color.b, 30);
+    const float outer = radius + 1.0f;
+    const auto& circle = unitCircle<DETECTION_SEGMENTS>();
+
+    std::vector<sf::Vertex> shape;
+    shape.reserve(DETECTION_SEGMENTS * 9);
+    for (int i = 0; i < DETECTION_SEGMENTS; ++i) {
+        const sf::Vector2f u0 = circle[i];
+        const sf::Vector2f u1 = circle[i + 1];
+
+        shape.push_back({{0, 0}, fill});
+        shape.push_back({u0 * radius, fill});
+        shape.push_back({u1 * radius, fill});
+
+        // Le contour est hors du disque: l'ordre des triangles est libre
+        shape.push_back({u0 * radius, outline});
+        shape.push_back({u0 * outer, outline});
+        shape.push_back({u1 * radius, outline});
+        shape.push_back({u1 * radius, outline});
+        shape.push_back({u0 * outer, outline});
+        shape.push_back({u1 * outer, outline});
+    }
+    return shape;
+}
+
+static void submit(sf::RenderWindow& window, const std::vector<sf::Vertex>& layer, sf::PrimitiveType type) {
+    if (!layer.empty())
+        window.draw(layer.data(), layer.size(), type);
+}
+
+void WorldRenderer::draw(sf::RenderWindow& window, const sf::Font& font, const WorldSnapshot& world,
+                         GUI::GUIControls& gui, const Camera& camera) {
+    // ========== MONDE (vue de la caméra) ==========
+    window.setView(camera.view());
+
+    // Dessiner terrain (un seul sprite: découpé par la carte graphique)
+    drawTerrain(window, world);
+
+    sf::FloatRect area = camera.visibleArea();
+    area.position -= sf::Vector2f(CULL_MARGIN, CULL_MARGIN);
+    area.size += sf::Vector2f(2 * CULL_MARGIN, 2 * CULL_MARGIN);
+    visibleCells = world.grid.cellsIn(area);
+
+    if (camera.scale() < LOD_SCALE)
+        drawDensity(window, world, camera.scale());
+    else
+        drawDetails(window, font, world, gui);
+
+    // ========== PANNEAUX (vue fixe) ==========
+    window.setView(window.getDefaultView());
+
+    drawStats(window, font, world);
+
+    // Dessiner graphique et GUI
+    world.graph.draw(window, font);
+    gui.draw(window, font);
+}
+
+// Entités une à une, seulement dans les cellules visibles
+void WorldRenderer::drawDetails(sf::RenderWindow& window, const sf::Font& font, const WorldSnapshot& world,
+                                const GUI::GUIControls& gui) {
+    // Dessiner nourriture
+    drawFood(window, world);
+
+    //Dessiner la vitesse de chaque entitée
+    if (gui.showAverageSpeed) {
+        speedLabels.clear();
+        appendSpeedLabels(font, world, world.preys, world.preyCells);
+        appendSpeedLabels(font, world, world.predators, world.predatorCells);
+        speedLabels.draw(window);
+    }
+
+    // Dessiner cercles de détection
+    if (gui.showDetectionRadius) {
+        if (preyDetectionTemplate.empty()) {
+            preyDetectionTemplate = buildDetectionTemplate(Prey::DETECTION_RADIUS, sf::Color(0, 255, 0));
+            predatorDetectionTemplate = buildDetectionTemplate(Predator::DETECTION_RADIUS, sf::Color(255, 0, 0));
+        }
+        drawDetectionRadius(window, world, world.preys, world.preyCells,
+                            preyDetectionTemplate, preyDetectionLayer);
+        drawDetectionRadius(window, world, world.predators, world.predatorCells,
+                            predatorDetectionTemplate, predatorDetectionLayer);
+    }
+
+    // Dessiner entités
+    drawEntities(window, world, world.preys, world.preyCells, preyLayer);
+    drawEntities(window, world, world.predators, world.predatorCells, predatorLayer);
+    if (gui.showDirectionLines)
+        drawDirections(window, world);
+}
+
+// ============================================================================
+// TERRAIN
+// ============================================================================
+// Un texel par unité du monde, sauf au-delà de TERRAIN_MAX_TEXTURE texels
+// de côté: le terrain d'un grand monde est cuit en plus basse résolution
+// puis étiré par le sprite
+bool WorldRenderer::bakeTerrain(const std::vector<TerrainTile>& terrain, const WorldConfig& world) {
+    terrainScale = std::min(1.0f, TERRAIN_MAX_TEXTURE / std::max(world.width, world.height));
+    const sf::Vector2u size((unsigned)std::ceil(world.width * terrainScale),
+                            (unsigned)std::ceil(world.height * terrainScale));
+    if (terrainTexture.getSize() != size && !terrainTexture.resize(size))
+        return false;
+
+    terrainTexture.setView(sf::View(sf::FloatRect({0, 0}, world.size())));
+    terrainTexture.clear(BACKGROUND);
+    for (const auto& tile : terrain)
+        tile.draw(terrainTexture);
+    terrainTexture.display();
+    return true;
+}
+
+void WorldRenderer::drawTerrain(sf::RenderWindow& window, const WorldSnapshot& world) {
+    if (!world.terrain) return;
+
+    if (world.terrain != bakedTerrain) {
+        bakedTerrain = world.terrain;
+        terrainBaked = bakeTerrain(*world.terrain, world.world);
+    }
+
+    if (terrainBaked) {
+        sf::Sprite sprite(terrainTexture.getTexture());
+        sprite.setScale({1.0f / terrainScale, 1.0f / terrainScale});
+        window.draw(sprite);
+    } else {
+        for (const auto& tile : *world.terrain)
+            tile.draw(window);
+    }
+}
+
+void WorldRenderer::drawFood(sf::RenderWindow& window, const WorldSnapshot& world) {
+    foodLayer.clear();
+    forEachVisible(world, world.food, world.foodCells, [this](sf::Vector2f pos) {
+        appendDisc<FOOD_SEGMENTS>(foodLayer, pos, 3, sf::Color(150, 255, 150));
+    });
+    submit(window, foodLayer, sf::PrimitiveType::Triangles);
+}
+
+// Le cercle représentant chaque entité
+void WorldRenderer::drawEntities(sf::RenderWindow& window, const WorldSnapshot& world,
+                                 const std::vector<EntitySnapshot>& entities, const std::vector<int>& cells,
+                                 std::vector<sf::Vertex>& layer) {
+    layer.clear();
+    forEachVisible(world, entities, cells, [&layer](const EntitySnapshot& e) {
+        appendDisc<DISC_SEGMENTS>(layer, e.pos, e.radius, e.color);
+    });
+    submit(window, layer, sf::PrimitiveType::Triangles);
+}
+
+// Une ligne par entité indiquant la direction du mouvement (les deux espèces)
+void WorldRenderer::drawDirections(sf::RenderWindow& window, const WorldSnapshot& world) {
+    directionLayer.clear();
+    auto appendLine = [this](const EntitySnapshot& e) {
+        directionLayer.push_back({e.pos, sf::Color::White});
+        directionLayer.push_back({e.pos + e.vel * 2.0f, sf::Color::White});
+    };
+    forEachVisible(world, world.preys, world.preyCells, appendLine);
+    forEachVisible(world, world.predators, world.predatorCells, appendLine);
+    submit(window, directionLayer, sf::PrimitiveType::Lines);
+}
+
+// Une étiquette par entité, toutes dans le même lot (un seul appel de dessin)
+void WorldRenderer::appendSpeedLabels(const sf::Font& font, const WorldSnapshot& world,
+                                      const std::vector<EntitySnapshot>& entities, const std::vector<int>& cells) {
+    char label[32];
+    forEachVisible(world, entities, cells, [&](const EntitySnapshot& e) {
+        float avgSpeed = std::sqrt(e.vel.x * e.vel.x + e.vel.y * e.vel.y);
+        const int length = std::snprintf(label, sizeof(label), "%g", avgSpeed);
+        speedLabels.append(font, std::string_view(label, length), e.pos, sf::Color::White);
+    });
+}
+
+// Une copie décalée du gabarit par entité, toute l'espèce en un appel
+void WorldRenderer::drawDetectionRadius(sf::RenderWindow& window, const WorldSnapshot& world,
+                                        const std::vector<EntitySnapshot>& entities, const std::vector<int>& cells,
+                                        const std::vector<sf::Vertex>& shape, std::vector<sf::Vertex>& layer) {
+    layer.clear();
+    forEachVisible(world, entities, cells, [&](const EntitySnapshot& e) {
+        const size_t first = layer.size();
+        layer.insert(layer.end(), shape.begin(), shape.end());
+        for (size_t k = first; k < layer.size(); ++k)
+            layer[k].position += e.pos;
+    });
+    submit(window, layer, sf::PrimitiveType::Triangles);
+}
+
+// ============================================================================
+// DENSITÉ (vue lointaine)
+// ============================================================================
+// Les cellules sont regroupées en blocs d'au moins SPLAT_PIXELS à l'écran,
+// alignés sur la grille (ils ne bougent pas quand la vue glisse). Chaque
+// espèce ajoute un carré dont l'opacité suit le nombre d'éléments par unité
+// de surface: un bloc est saturé à un élément pour SATURATION_AREA unités².
+// Le coût ne dépend que du nombre de blocs visibles.
+// ============================================================================
+static constexpr float SATURATION_AREA = 400.0f;
+
+static void appendSplat(std::vector<sf::Vertex>& layer, const sf::FloatRect& bounds, int count,
+                        float weight, sf::Color color) {
+    if (count == 0) return;
+
+    const float density = count * weight * SATURATION_AREA / (bounds.size.x * bounds.size.y);
+    color.a = static_cast<std::uint8_t>(std::min(1.0f, density) * 220.0f);
+
+    const sf::Vector2f a = bounds.position;
+    const sf::Vector2f b = bounds.position + sf::Vector2f(bounds.size.x, 0);
+    const sf::Vector2f c = bounds.position + bounds.size;
+    const sf::Vector2f d = bounds.position + sf::Vector2f(0, bounds.size.y);
+    for (sf::Vector2f p : {a, b, c, a, c, d})
+        layer.push_back({p, color});
+}
+
+void WorldRenderer::drawDensity(sf::RenderWindow& window, const WorldSnapshot& world, float scale) {
+    densityLayer.clear();
+    if (world.preyCells.empty()) return;   // Snapshot pas encore rempli
+
+    const SnapshotGrid& grid = world.grid;
+    const sf::Vector2f cell = grid.cellSize();
+    const int block = std::max(1, (int)std::ceil(SPLAT_PIXELS / (std::min(cell.x, cell.y) * scale)));
+
+    // Nombre d'éléments des cellules [x0, x1] x [y0, y1]
+    auto countIn = [&](const std::vector<int>& cells, int x0, int y0, int x1, int y1) {
+        int count = 0;
+        for (int y = y0; y <= y1; ++y)
+            count += cells[grid.cell(x1, y) + 1] - cells[grid.cell(x0, y)];
+        return count;
+    };
+
+    for (int by = visibleCells.y0 / block * block; by <= visibleCells.y1; by += block) {
+        for (int bx = visibleCells.x0 / block * block; bx <= visibleCells.x1; bx += block) {
+            const int x1 = std::min(bx + block, grid.columns()) - 1;
+            const int y1 = std::min(by + block, grid.rowCount()) - 1;
+            const sf::FloatRect bounds({bx * cell.x, by * cell.y},
+                                       {(x1 - bx + 1) * cell.x, (y1 - by + 1) * cell.y});
+
+            appendSplat(densityLayer, bounds, countIn(world.foodCells, bx, by, x1, y1),
+                        0.25f, sf::Color(150, 255, 150));
+            appendSplat(densityLayer, bounds, countIn(world.preyCells, bx, by, x1, y1),
+                        1.0f, sf::Color(0, 255, 0));
+            appendSplat(densityLayer, bounds, countIn(world.predatorCells, bx, by, x1, y1),
+                        1.0f, sf::Color(255, 0, 0));
+        }
+    }
+    submit(window, densityLayer, sf::PrimitiveType::Triangles);
+}
+
+// Reformaté à chaque frame (sans allocation), remis en page seulement si le
+// texte diffère: le temps n'est affiché qu'au dixième de seconde
+void WorldRenderer::drawStats(sf::RenderWindow& window, const sf::Font& font, const WorldSnapshot& world) {
+    char text[512];
+    int length = std::snprintf(text, sizeof(text),
+                               "Generation: %d\n"
+                               "Proies: %zu (Gen %d)\n"
+                               "Predateurs: %zu (Gen %d)\n"
+                               "Nourriture: %zu\n"
+                               "Temps: %.1fs / %ds\n",
+                               world.generation,
+                               world.preys.size(), world.preyGeneration,
+                               world.predators.size(), world.predGeneration,
+                               world.food.size(),
+                               world.timer, (int)world.generationTime);
+
+    if (!world.preys.empty()) {
+        length += std::snprintf(text + length, sizeof(text) - length,
+                                "Proies Fitness: %d | E: %d\n",
+                                (int)world.preyAvgFitness, (int)world.preyAvgEnergy);
+    }
+
+    if (!world.predators.empty()) {
+        length += std::snprintf(text + length, sizeof(text) - length,
+                                "Preds Fitness: %d\n"
+                                "Captures: %d | Faim: %.1fs",
+                                (int)world.predatorAvgFitness,
+                                world.totalKills, world.predatorAvgHunger);
+    }
+
+    statsText.setString(font, text);
+    statsText.draw(window);
+}
@@ -0,0 +1,123 @@
+#ifndef WORLDRENDERER_H
+#define WORLDRENDERER_H
+#include "worldsnapshot.h"
+#include "gui.h"
+#include "textoverlay.h"
+#include "camera.h"
+#include "entity.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <vector>
+
+// ============================================================================
+// WORLD RENDERER - Dessine un WorldSnapshot
+// ============================================================================
+// Tourne sur le thread de la fenêtre et ne voit que des snapshots: la
+// simulation n'est jamais lue pendant le dessin. gui fournit les options
+// d'affichage (détection, lignes, vitesses) et dessine ses propres panneaux.
+//
+// Les formes sont regroupées par couche: chaque couche (nourriture, proies,
+// prédateurs, lignes de direction) est UN tableau de sommets rempli à
+// chaque frame et envoyé en UN appel de dessin, quel que soit le nombre
+// d'entités. Les disques sont des triangles autour d'un cercle unité
+// précalculé. Les tableaux gardent leur capacité d'une frame à l'autre.
+//
+// Les cercles de détection ont le même rayon pour toute une espèce: un
+// gabarit (disque + contour) est construit une fois par espèce, puis recopié
+// décalé au centre de chaque entité dans un tableau par espèce.
+//
+// Les textes passent par TextBatch: toutes les étiquettes de vitesse forment
+// un seul tableau de glyphes, le bloc de statistiques n'est remis en page
+// que lorsque ses valeurs affichées changent.
+//
+// Le terrain est statique: il est rastérisé une fois dans une texture hors
+// écran (sur le fond, ses couleurs étant translucides) puis recopié en un
+// seul sprite. Il n'est re-cuit que si le snapshot annonce un autre terrain.
+//
+// Le monde est dessiné dans la vue de la Camera, les panneaux dans la vue
+// fixe de la fenêtre. Seules les cellules du WorldSnapshot qui recoupent la
+// vue (élargie de CULL_MARGIN: cercles de détection, étiquettes) sont lues.
+// De loin (moins de LOD_SCALE pixels par unité), les entités ne sont plus
+// dessinées une à une: chaque bloc de cellules devient un carré dont
+// l'opacité suit la densité de proies, prédateurs et nourriture.
+// ============================================================================
+class WorldRenderer {
+public:
+    // Couleur de fond de la fenêtre (et de la texture du terrain)
+    static constexpr sf::Color BACKGROUND{20, 20, 30};
+
+    void draw(sf::RenderWindow& window, const sf::Font& font, const WorldSnapshot& world,
+              GUI::GUIControls& gui, const Camera& camera);
+
+private:
+    // ========== CULLING ==========
+    static constexpr float CULL_MARGIN = std::max(Prey::DETECTION_RADIUS, Predator::DETECTION_RADIUS) + 1.0f;
+    static constexpr float LOD_SCALE = 0.5f;      // Pixels par unité sous lesquels on passe en densité
+    static constexpr float SPLAT_PIXELS = 6.0f;   // Côté minimal d'un carré de densité à l'écran
+
+    SnapshotGrid::CellRange visibleCells;   // Cellules lues pour la frame en cours
+
+    // Appelle fn(élément) pour chaque élément de items rangé dans une cellule visible
+    template <typename T, typename Fn>
+    void forEachVisible(const WorldSnapshot& world, const std::vector<T>& items,
+                        const std::vector<int>& cells, Fn&& fn) const;
+
+    // ========== TERRAIN PRÉ-RENDU ==========
+    sf::RenderTexture terrainTexture;
+    std::shared_ptr<const std::vector<TerrainTile>> bakedTerrain;   // Tenu: son adresse ne peut pas être réutilisée
+    bool terrainBaked = false;   // false: texture indisponible, dessin direct
+    float terrainScale = 1.0f;   // Texels par unité du monde
+    static constexpr float TERRAIN_MAX_TEXTURE = 4096.0f;
+
+    bool bakeTerrain(const std::vector<TerrainTile>& terrain, const WorldConfig& world);
+    void drawTerrain(sf::RenderWindow& window, const WorldSnapshot& world);
+
+    // ========== COUCHES (sommets réutilisés d'une frame à l'autre) ==========
+    std::vector<sf::Vertex> foodLayer;
+    std::vector<sf::Vertex> preyLayer;
+    std::vector<sf::Vertex> predatorLayer;
+    std::vector<sf::Vertex> directionLayer;
+    std::vector<sf::Vertex> densityLayer;
+
+    // ========== CERCLES DE DÉTECTION ==========
+    // Gabarits centrés sur l'origine (construits au premier usage)
+    std::vector<sf::Vertex> preyDetectionTemplate;
+    std::vector<sf::Vertex> predatorDetectionTemplate;
+    std::vector<sf::Vertex> preyDetectionLayer;
+    std::vector<sf::Vertex> predatorDetectionLayer;
+
+    // ========== TEXTES ==========
+    TextBatch speedLabels{10};
+    CachedText statsText{11, {10.0f, 10.0f}, sf::Color::White, 1.0f, sf::Color::Black};
+
+    void drawDetails(sf::RenderWindow& window, const sf::Font& font, const WorldSnapshot& world,
+                     const GUI::GUIControls& gui);
+    void drawFood(sf::RenderWindow& window, const WorldSnapshot& world);
+    void drawEntities(sf::RenderWindow& window, const WorldSnapshot& world,
+                      const std::vector<EntitySnapshot>& entities, const std::vector<int>& cells,
+                      std::vector<sf::Vertex>& layer);
+    void drawDirections(sf::RenderWindow& window, const WorldSnapshot& world);
+    void appendSpeedLabels(const sf::Font& font, const WorldSnapshot& world,
+                           const std::vector<EntitySnapshot>& entities, const std::vector<int>& cells);
+    void drawDetectionRadius(sf::RenderWindow& window, const WorldSnapshot& world,
+                             const std::vector<EntitySnapshot>& entities, const std::vector<int>& cells,
+                             const std::vector<sf::Vertex>& shape, std::vector<sf::Vertex>& layer);
+    void drawDensity(sf::RenderWindow& window, const WorldSnapshot& world, float scale);
+    void drawStats(sf::RenderWindow& window, const sf::Font& font, const WorldSnapshot& world);
+};
+
+template <typename T, typename Fn>
+void WorldRenderer::forEachVisible(const WorldSnapshot& world, const std::vector<T>& items,
+                                   const std::vector<int>& cells, Fn&& fn) const {
+    if (cells.empty()) return;   // Snapshot pas encore rempli
+
+    for (int y = visibleCells.y0; y <= visibleCells.y1; ++y) {
+        // Les cellules d'une ligne sont contiguës: une seule plage par ligne
+        const int first = cells[world.grid.cell(visibleCells.x0, y)];
+        const int last = cells[world.grid.cell(visibleCells.x1, y) + 1];
+        for (int k = first; k < last; ++k)
+            fn(items[k]);
+    }
+}
+
+#endif // WORLDRENDERER_H
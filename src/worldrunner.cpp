@@ -0,0 +1,74 @@
+#include "worldrunner.h"
+#include "gui.h"
+#include <algorithm>
+#include <memory>
+
+// ============================================================================
+// RESULTS SINK
+// ============================================================================
+void ResultsSink::record(size_t world, long long tick, const GenerationStats& stats) {
+    std::lock_guard<std::mutex> lock(mutex);
+    rows.push_back({world, tick, stats});
+}
+
+std::vector<WorldGenerationRecord> ResultsSink::records() const {
+    std::vector<WorldGenerationRecord> sorted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sorted = rows;
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        if (a.world != b.world) return a.world < b.world;
+        return a.stats.generation < b.stats.generation;
+    });
+    return sorted;
+}
+
+void ResultsSink::writeCsv(std::ostream& out, const std::vector<WorldSpec>& specs) const {
+    out << "world,seed,mutation_rate,generation_time,generation,tick,preys,predators,food,"
+           "prey_avg_fitness,prey_best_fitness,predator_avg_fitness,predator_best_fitness\n";
+    for (const auto& row : records()) {
+        const WorldSpec& spec = specs[row.world];
+        const GenerationStats& s = row.stats;
+        out << row.world << ',' << spec.config.seed << ',' << spec.mutationRate << ','
+            << spec.generationTime << ',' << s.generation << ',' << row.tick << ','
+            << s.preys << ',' << s.predators << ',' << s.food << ','
+            << s.preyAvgFitness << ',' << s.preyBestFitness << ','
+            << s.predatorAvgFitness << ',' << s.predatorBestFitness << '\n';
+    }
+}
+
+// ============================================================================
+// WORLD RUNNER
+// ============================================================================
+void WorldRunner::runWorld(size_t index, ResultsSink& sink) const {
+    const WorldSpec& spec = specs[index];
+
+    GUI::GUIControls gui;
+    gui.mutationRate = spec.mutationRate;
+    gui.generationTime = spec.generationTime;
+
+    auto sim = std::make_unique<Simulation>(gui, spec.config);
+    int generation = sim->getGeneration();
+
+    for (long long tick = 1; tick <= spec.ticks; ++tick) {
+        sim->update(spec.dt);
+
+        // evolve() vient de clore une génération
+        if (sim->getGeneration() != generation) {
+            generation = sim->getGeneration();
+            sink.record(index, tick, sim->lastGenerationStats());
+        }
+    }
+}
+
+void WorldRunner::run(ResultsSink& sink) const {
+    // Un seul noeud: un bloc par monde
+    ScratchArena arena(4096);
+    TaskGraph batch(arena);
+    batch.parallelFor(specs.size(), 1, [this, &sink](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            runWorld(i, sink);
+    });
+    TaskScheduler::shared().run(batch);
+}
@@ -0,0 +1,76 @@
+#ifndef WORLDRUNNER_H
+#define WORLDRUNNER_H
+#include "simulation.h"
+#include <vector>
+#include <mutex>
+#include <ostream>
+#include <cstddef>
+#include <utility>
+
+// ============================================================================
+// WORLD SPEC - Un monde d'un lot: graine, paramètres et durée
+// ============================================================================
+struct WorldSpec {
+    SimulationConfig config;
+    float mutationRate = 0.15f;      // GUIControls::mutationRate
+    float generationTime = 30.0f;    // GUIControls::generationTime
+    long long ticks = 60 * 60 * 30;  // 30 minutes simulées
+    float dt = 1.0f / 60.0f;
+};
+
+// Une génération terminée dans un monde du lot
+struct WorldGenerationRecord {
+    size_t world;      // Index dans le lot
+    long long tick;    // Tick où la génération s'est close
+    GenerationStats stats;
+};
+
+// ============================================================================
+// RESULTS SINK - Seul état partagé entre les mondes
+// ============================================================================
+// Les mondes y déposent leurs bilans de génération depuis n'importe quel
+// thread (un mutex protège la liste). L'ordre d'arrivée dépend de
+// l'ordonnancement: records() rend les lignes triées par monde puis par
+// génération, le résultat est donc le même quel que soit le nombre de threads.
+// ============================================================================
+class ResultsSink {
+public:
+    void record(size_t world, long long tick, const GenerationStats& stats);
+
+    std::vector<WorldGenerationRecord> records() const;
+
+    // Une ligne par génération, avec les paramètres du monde
+    void writeCsv(std::ostream& out, const std::vector<WorldSpec>& specs) const;
+
+private:
+    mutable std::mutex mutex;
+    std::vector<WorldGenerationRecord> rows;
+};
+
+// ============================================================================
+// WORLD RUNNER - K mondes indépendants en parallèle
+// ============================================================================
+// Chaque monde a sa Simulation et ses GUIControls (ses paramètres), créés et
+// détruits dans sa tâche: ils ne partagent ni générateur, ni arène, ni index
+// (voir Simulation). Les mondes sont les blocs d'une boucle parallèle du
+// TaskScheduler; le tick de chaque monde lance son propre graphe dans le
+// même ordonnanceur, les coeurs libres (fin de lot, mondes moins nombreux
+// que les threads) aident donc les mondes restants.
+// ============================================================================
+class WorldRunner {
+public:
+    explicit WorldRunner(std::vector<WorldSpec> specs) : specs(std::move(specs)) {}
+
+    const std::vector<WorldSpec>& worlds() const { return specs; }
+
+    // Bloque jusqu'à la fin de tous les mondes (sur TaskScheduler::shared(),
+    // celui qu'utilise le tick des simulations)
+    void run(ResultsSink& sink) const;
+
+private:
+    std::vector<WorldSpec> specs;
+
+    void runWorld(size_t index, ResultsSink& sink) const;
+};
+
+#endif // WORLDRUNNER_H
@@ -0,0 +1,68 @@
+#ifndef WORLDSNAPSHOT_H
+#define WORLDSNAPSHOT_H
+#include "gui.h"
+#include "terraintype.h"
+#include "snapshotgrid.h"
+#include "worldconfig.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <map>
+#include <memory>
+#include <string>
+
+// Ce que le rendu doit savoir d'une entité
+struct EntitySnapshot {
+    sf::Vector2f pos;
+    sf::Vector2f vel;
+    float radius;
+    sf::Color color;
+};
+
+// ============================================================================
+// WORLD SNAPSHOT - Copie immuable du monde pour le thread de rendu
+// ============================================================================
+// Remplie par Simulation::snapshot() entre deux ticks, puis publiée dans un
+// TripleBuffer (voir SimulationThread). Le rendu ne lit jamais la
+// Simulation elle-même: il dessine la dernière copie publiée pendant que
+// la simulation continue d'avancer.
+// ============================================================================
+struct WorldSnapshot {
+    WorldConfig world;   // Dimensions de la carte (vue, terrain, grille)
+
+    std::vector<EntitySnapshot> preys;
+    std::vector<EntitySnapshot> predators;
+    std::vector<sf::Vector2f> food;
+
+    // Les trois tableaux ci-dessus sont rangés par cellule de grid:
+    // xxxCells[c] est le début de la cellule c (vides avant le premier remplissage)
+    SnapshotGrid grid{world.width, world.height};
+    std::vector<int> preyCells;
+    std::vector<int> predatorCells;
+    std::vector<int> foodCells;
+
+    // Terrain partagé, pas copié: la Simulation ne modifie jamais un terrain
+    // publié, generateTerrain() en crée un nouveau. Le snapshot garde donc
+    // en vie celui qu'il montre, et un autre pointeur = un autre terrain.
+    std::shared_ptr<const std::vector<TerrainTile>> terrain;
+
+    GUI::FitnessGraph graph;
+
+    // ========== STATISTIQUES ==========
+    int generation = 0;
+    int preyGeneration = 0;
+    int predGeneration = 0;
+    float timer = 0;
+    float generationTime = 0;
+    float preyAvgFitness = 0;
+    float preyAvgEnergy = 0;
+    float predatorAvgFitness = 0;
+    float predatorAvgHunger = 0;
+    int totalKills = 0;
+
+    // Vitesse obtenue par la boucle de simulation (temps simulé / réel)
+    float achievedSpeed = 0;
+    // Valeurs du debug monitor côté simulation
+    std::map<std::string, float> debugValues;
+};
+
+#endif // WORLDSNAPSHOT_H
@@ -0,0 +1,71 @@
+#include "neuralkernels.h"
+#include "randomstream.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// ============================================================================
+// DENSE - Noyaux SIMD comparés au noyau scalaire
+// ============================================================================
+// Pour chaque implémentation supportée par le CPU, sur plusieurs topologies
+// (celles des cerveaux et des tailles avec lignes incomplètes), l'écart à la
+// version scalaire doit rester sous la borne documentée dans
+// neuralkernels.h (~2e-6; mesuré: 1.04e-6 au pire, sur 8x64).
+// Les poids et entrées couvrent des sommes hors de [-10, 10] pour exercer
+// aussi la saturation de la sigmoïde.
+// ============================================================================
+static constexpr float TOLERANCE = 2e-6f;
+static constexpr int TRIALS = 200;
+
+template <int Rows, int Stride>
+static int check(NeuralKernels::DenseFn<Rows, Stride> simd, const char* name) {
+    constexpr int PaddedRows = (Rows + 7) & ~7;
+    RandomStream rng(1, RandomPurpose::Spawn, Rows, Stride);
+
+    float worst = 0;
+    for (int trial = 0; trial < TRIALS; ++trial) {
+        std::vector<float> weights(Rows * Stride), bias(PaddedRows, 0.0f), x(Stride);
+        const float scale = trial % 2 ? 1.0f : 4.0f;   // Une fois sur deux, sommes saturées
+        for (float& w : weights) w = rng.uniform(-scale, scale);
+        for (int i = 0; i < Rows; ++i) bias[i] = rng.uniform(-1.0f, 1.0f);
+        for (float& v : x) v = rng.uniform(-1.0f, 1.0f);
+
+        float expected[Rows], actual[Rows];
+        NeuralKernels::detail::denseScalar<Rows, Stride>(weights.data(), bias.data(), x.data(), expected);
+        simd(weights.data(), bias.data(), x.data(), actual);
+        for (int i = 0; i < Rows; ++i)
+            worst = std::max(worst, std::fabs(expected[i] - actual[i]));
+    }
+
+    if (!(worst <= TOLERANCE)) {
+        std::cerr << name << " " << Rows << "x" << Stride << ": ecart " << worst
+                  << " > " << TOLERANCE << '\n';
+        return 1;
+    }
+    return 0;
+}
+
+template <int Rows, int Stride>
+static int checkAll() {
+    int failures = 0;
+#ifdef BIOSIM_X86
+    using NeuralKernels::Isa;
+    if (NeuralKernels::supported(Isa::SSE4))
+        failures += check<Rows, Stride>(NeuralKernels::detail::denseSSE4<Rows, Stride>, "sse4");
+    if (NeuralKernels::supported(Isa::AVX2))
+        failures += check<Rows, Stride>(NeuralKernels::detail::denseAVX2<Rows, Stride>, "avx2");
+#endif
+    return failures;
+}
+
+int main() {
+    int failures = 0;
+    failures += checkAll<20, 8>();    // Couche cachée des cerveaux (8 -> 20)
+    failures += checkAll<2, 24>();    // Couche de sortie (20 -> 2)
+    failures += checkAll<5, 16>();
+    failures += checkAll<13, 32>();
+    failures += checkAll<8, 64>();
+    std::cout << "noyau actif: " << NeuralKernels::name() << '\n';
+    return failures == 0 ? 0 : 1;
+}
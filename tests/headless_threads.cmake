@@ -0,0 +1,37 @@
+# ============================================================================
+# HEADLESS_THREADS - Même graine, même monde, quel que soit le nombre de threads
+# ============================================================================
+# cmake -DHEADLESS=<headless> -DOUT_DIR=<dossier> -P headless_threads.cmake
+# Lance deux fois headless (BIOSIM_THREADS=1 puis 4) et compare les CSV
+# --stats octet par octet, pour un monde seul puis en îles.
+# ============================================================================
+if(NOT HEADLESS OR NOT OUT_DIR)
+    message(FATAL_ERROR "HEADLESS et OUT_DIR sont requis")
+endif()
+file(MAKE_DIRECTORY "${OUT_DIR}")
+
+function(run_headless name threads)
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E env BIOSIM_THREADS=${threads}
+                "${HEADLESS}" ${ARGN} --stats "${OUT_DIR}/${name}_${threads}.csv"
+        RESULT_VARIABLE result
+        OUTPUT_QUIET)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "headless ${ARGN} (BIOSIM_THREADS=${threads}) a échoué: ${result}")
+    endif()
+endfunction()
+
+function(check_threads name)
+    run_headless(${name} 1 ${ARGN})
+    run_headless(${name} 4 ${ARGN})
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -E compare_files
+                "${OUT_DIR}/${name}_1.csv" "${OUT_DIR}/${name}_4.csv"
+        RESULT_VARIABLE different)
+    if(different)
+        message(FATAL_ERROR "${name}: les statistiques diffèrent entre 1 et 4 threads")
+    endif()
+endfunction()
+
+check_threads(world --seed 7 --ticks 6000)
+check_threads(islands --seed 3 --ticks 6000 --islands 4)